@@ -1,13 +1,16 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
-#include <algorithm>
-#include <numeric>
+#include <atomic>
+#include <cstdint>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_sort.h>
 
 #include "Cluster.h"
+#include "DisjointSets.h"
 #include "NeighborBond.h"
 #include "NeighborComputeFunctional.h"
-#include "dset/dset.h"
+#include "utils.h"
 
 //! Finds clusters using a network of neighbors.
 namespace freud { namespace cluster {
@@ -19,105 +22,167 @@ void Cluster::compute(const freud::locality::NeighborQuery* nq, const freud::loc
     m_cluster_idx.prepare(num_points);
     DisjointSets dj(num_points);
 
+    // Merging sets is symmetric, so a ball query only needs to find each pair
+    // of neighbors once.
+    if (nlist == nullptr && qargs.mode != freud::locality::QueryType::nearest
+        && qargs.num_neighbors == freud::locality::DEFAULT_NUM_NEIGHBORS)
+    {
+        qargs.half_list = true;
+    }
+
+    // The disjoint sets support concurrent merging, so bonds are processed in
+    // parallel. Half lists are accepted since merging is symmetric.
     freud::locality::loopOverNeighbors(
         nq, nq->getPoints(), num_points, qargs, nlist,
         [&dj](const freud::locality::NeighborBond& neighbor_bond) {
-            // Merge the two sets using the disjoint set
-            if (!dj.same(neighbor_bond.point_idx, neighbor_bond.query_point_idx))
+            dj.unite(neighbor_bond.point_idx, neighbor_bond.query_point_idx);
+        },
+        true, true);
+
+    assignClusters(dj, num_points, keys);
+}
+
+void Cluster::compute(unsigned int num_points, const freud::locality::NeighborList& nlist,
+                      const bool* bond_mask, const unsigned int* keys)
+{
+    nlist.validate(num_points, num_points);
+    m_cluster_idx.prepare(num_points);
+    DisjointSets dj(num_points);
+
+    const auto& neighbors = nlist.getNeighbors();
+    util::forLoopWrapper(0, nlist.getNumBonds(), [&](size_t begin, size_t end) {
+        for (size_t bond = begin; bond < end; ++bond)
+        {
+            if (bond_mask[bond])
             {
-                dj.unite(neighbor_bond.point_idx, neighbor_bond.query_point_idx);
+                dj.unite(neighbors(bond, 0), neighbors(bond, 1));
             }
-        });
-
-    // Done looping over points. All clusters are now determined.
-    // Next, we renumber clusters from zero to num_clusters-1.
-    // These new cluster indexes are then sorted by cluster size from largest
-    // to smallest, with equally-sized clusters sorted based on their minimum
-    // point index.
-    std::vector<size_t> cluster_label(num_points, num_points);
-    std::vector<size_t> cluster_label_count(num_points);
-    std::vector<size_t> cluster_min_id(num_points, num_points);
-
-    // Loop over every point.
-    m_num_clusters = 0;
-    for (size_t i = 0; i < num_points; i++)
-    {
-        size_t s = dj.find(i);
+        }
+    });
+
+    assignClusters(dj, num_points, keys);
+}
 
-        // Label this cluster if we haven't seen it yet.
-        if (cluster_label[s] == num_points)
+void Cluster::assignClusters(const DisjointSets& dj, unsigned int num_points, const unsigned int* keys)
+{
+    // All clusters are now determined. The root of each set is the smallest
+    // point index in its cluster. Next, we find the root of every point and
+    // count the points in each cluster.
+    std::vector<unsigned int> point_roots(num_points);
+    std::vector<std::atomic<unsigned int>> root_counts(num_points);
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            root_counts[i].store(0, std::memory_order_relaxed);
+        }
+    });
+    tbb::enumerable_thread_specific<std::vector<unsigned int>> local_roots;
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        std::vector<unsigned int>& roots = local_roots.local();
+        // Neighboring points usually share a cluster, so counts are summed
+        // over runs of equal roots to avoid contention on large clusters.
+        unsigned int run_root = 0;
+        unsigned int run_length = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const unsigned int root = dj.find(i);
+            point_roots[i] = root;
+            if (root == i)
+            {
+                roots.push_back(root);
+            }
+            if (root != run_root && run_length != 0)
+            {
+                root_counts[run_root].fetch_add(run_length, std::memory_order_relaxed);
+                run_length = 0;
+            }
+            run_root = root;
+            ++run_length;
+        }
+        if (run_length != 0)
         {
-            // Label this cluster uniquely.
-            cluster_label[s] = m_num_clusters;
-            // Track the smallest point index in this cluster.
-            cluster_min_id[cluster_label[s]] = i;
-            // Increment the count of unique clusters.
-            m_num_clusters++;
+            root_counts[run_root].fetch_add(run_length, std::memory_order_relaxed);
         }
+    });
 
-        // Increment the counter for this cluster label.
-        cluster_label_count[cluster_label[s]]++;
+    // Renumber clusters from zero to num_clusters-1, sorted by cluster size
+    // from largest to smallest, with equally-sized clusters sorted based on
+    // their minimum point index.
+    std::vector<unsigned int> cluster_roots;
+    for (const auto& roots : local_roots)
+    {
+        cluster_roots.insert(cluster_roots.end(), roots.begin(), roots.end());
     }
+    tbb::parallel_sort(cluster_roots.begin(), cluster_roots.end(),
+                       [&root_counts](unsigned int root1, unsigned int root2) {
+                           const unsigned int count1 = root_counts[root1].load(std::memory_order_relaxed);
+                           const unsigned int count2 = root_counts[root2].load(std::memory_order_relaxed);
+                           if (count1 != count2)
+                           {
+                               // If the counts are unequal, return the largest cluster first.
+                               return count1 > count2;
+                           }
+                           return root1 < root2;
+                       });
+    m_num_clusters = cluster_roots.size();
+
+    std::vector<unsigned int> root_labels(num_points);
+    util::forLoopWrapper(0, m_num_clusters, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            root_labels[cluster_roots[c]] = c;
+        }
+    });
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            m_cluster_idx[i] = root_labels[point_roots[i]];
+        }
+    });
 
-    // Resize label counts and min ids to the number of unique clusters found.
-    cluster_label_count.resize(m_num_clusters);
-    cluster_label_count.shrink_to_fit();
-    cluster_min_id.resize(m_num_clusters);
-    cluster_min_id.shrink_to_fit();
-
-    // Get a permutation that reorders clusters, largest to smallest.
-    std::vector<size_t> cluster_reindex = sort_indexes_inverse(cluster_label_count, cluster_min_id);
-
-    // Clear the cluster keys
-    m_cluster_keys = std::vector<std::vector<unsigned int>>(m_num_clusters, std::vector<unsigned int>());
-
-    /* Loop over all points, set their cluster ids and add them to a list of
-     * sets. Each set contains all the keys that are part of that cluster. If
-     * no keys are provided, the keys use point ids. Get the computed list
-     * with getClusterKeys().
+    /* Sort the points by cluster, keeping points in each cluster sorted by
+     * index, and copy their keys into a list per cluster. If no keys are
+     * provided, the keys use point ids. Get the computed list with
+     * getClusterKeys().
      */
-    for (size_t i = 0; i < num_points; i++)
-    {
-        size_t s = dj.find(i);
-        size_t cluster_idx = cluster_reindex[cluster_label[s]];
-        m_cluster_idx[i] = cluster_idx;
-        unsigned int key = i;
-        if (keys != nullptr)
+    std::vector<uint64_t> cluster_points(num_points);
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
         {
-            key = keys[i];
+            cluster_points[i] = (static_cast<uint64_t>(m_cluster_idx[i]) << 32) | i;
         }
-        m_cluster_keys[cluster_idx].push_back(key);
-    }
-}
-
-// Returns inverse permutation of cluster indexes, sorted from largest to smallest.
-// Adapted from https://stackoverflow.com/questions/1577475/c-sorting-and-keeping-track-of-indexes
-std::vector<size_t> Cluster::sort_indexes_inverse(const std::vector<size_t>& counts,
-                                                  const std::vector<size_t>& min_ids)
-{
-    // Initialize original index locations.
-    std::vector<size_t> idx(counts.size());
-    std::iota(idx.begin(), idx.end(), 0);
+    });
+    tbb::parallel_sort(cluster_points.begin(), cluster_points.end());
 
-    // Sort indexes based on comparing values in counts, min_ids.
-    std::sort(idx.begin(), idx.end(), [&counts, &min_ids](size_t i1, size_t i2) {
-        if (counts[i1] != counts[i2])
+    // The points of each cluster are contiguous, so the first point of each
+    // cluster marks where its range begins.
+    std::vector<unsigned int> cluster_starts(m_num_clusters);
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t p = begin; p < end; ++p)
         {
-            // If the counts are unequal, return the largest cluster first.
-            return counts[i1] > counts[i2];
+            const auto cluster_idx = static_cast<unsigned int>(cluster_points[p] >> 32);
+            if (p == 0 || (cluster_points[p - 1] >> 32) != cluster_idx)
+            {
+                cluster_starts[cluster_idx] = p;
+            }
         }
-        // If the counts are equal, return the cluster with the smallest
-        // point id first.
-        return min_ids[i1] < min_ids[i2];
     });
 
-    // Invert the permutation.
-    std::vector<size_t> inv_idx(idx.size());
-    for (size_t i = 0; i < idx.size(); i++)
-    {
-        inv_idx[idx[i]] = i;
-    }
-    return inv_idx;
+    m_cluster_keys = std::vector<std::vector<unsigned int>>(m_num_clusters);
+    util::forLoopWrapper(0, m_num_clusters, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            const unsigned int start = cluster_starts[c];
+            const unsigned int count = root_counts[cluster_roots[c]].load(std::memory_order_relaxed);
+            std::vector<unsigned int>& cluster_keys = m_cluster_keys[c];
+            cluster_keys.resize(count);
+            for (unsigned int j = 0; j < count; ++j)
+            {
+                const auto i = static_cast<unsigned int>(cluster_points[start + j]);
+                cluster_keys[j] = (keys != nullptr) ? keys[i] : i;
+            }
+        }
+    });
 }
 
 }; }; // end namespace freud::cluster
@@ -16,6 +16,9 @@
 */
 
 namespace freud { namespace cluster {
+
+class DisjointSets;
+
 //! Finds clusters using a network of neighbors.
 /*! Given a set of points and their neighbors, freud.cluster.Cluster will
  *  determine all of the connected components of the network formed by those
@@ -47,6 +50,17 @@ public:
     void compute(const freud::locality::NeighborQuery* nq, const freud::locality::NeighborList* nlist,
                  freud::locality::QueryArgs qargs, const unsigned int* keys = nullptr);
 
+    //! Compute the point clusters formed by a subset of the bonds of a NeighborList.
+    /*! \param num_points Number of points.
+     *  \param nlist NeighborList whose points and query points are both the
+     *         num_points points.
+     *  \param bond_mask Array with one value per bond of nlist. Only bonds
+     *         whose value is true connect points.
+     *  \param keys Optional key for each point.
+     */
+    void compute(unsigned int num_points, const freud::locality::NeighborList& nlist, const bool* bond_mask,
+                 const unsigned int* keys = nullptr);
+
     //! Get the total number of clusters.
     unsigned int getNumClusters() const
     {
@@ -66,15 +80,12 @@ public:
     }
 
 private:
+    //! Label the clusters found by merging the sets of bonded points.
+    void assignClusters(const DisjointSets& dj, unsigned int num_points, const unsigned int* keys);
+
     unsigned int m_num_clusters;                           //!< Number of clusters found
     util::ManagedArray<unsigned int> m_cluster_idx;        //!< Cluster index for each point
     std::vector<std::vector<unsigned int>> m_cluster_keys; //!< List of keys in each cluster
-
-    // Returns inverse permutation of cluster indices, sorted from largest to
-    // smallest. Adapted from
-    // https://stackoverflow.com/questions/1577475/c-sorting-and-keeping-track-of-indexes
-    static std::vector<size_t> sort_indexes_inverse(const std::vector<size_t>& counts,
-                                                    const std::vector<size_t>& min_ids);
 };
 
 }; }; // end namespace freud::cluster
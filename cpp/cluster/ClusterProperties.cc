@@ -1,10 +1,17 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
 #include <vector>
 
 #include "ClusterProperties.h"
-#include "NeighborComputeFunctional.h"
+#include "utils.h"
 
 /*! \file ClusterProperties.cc
     \brief Routines for computing properties of point clusters.
@@ -12,81 +19,233 @@
 
 namespace freud { namespace cluster {
 
-/*! \param nq NeighborQuery containing the points making up the clusters
-    \param cluster_idx Index of which cluster each point belongs to
+namespace {
 
-    compute loops over all points in the given array and determines the center
-    of mass of the cluster as well as the gyration tensor. These can be
-    accessed after the call to compute with getClusterCenters() and
-    getClusterGyrations().
-*/
+//! Clusters with more points than this are reduced by several tasks.
+constexpr unsigned int SLICE_GRAIN_SIZE = 4096;
 
-void ClusterProperties::compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx)
+//! Mass and mass-weighted phase sums of the fractional coordinates of a cluster.
+/*! The center of mass is the circular mean of the fractional coordinates,
+    which is the argument of the phase sums.
+*/
+struct CenterSums
 {
-    // determine the number of clusters
-    const unsigned int* max_cluster_id = std::max_element(cluster_idx, cluster_idx + nq->getNPoints());
-    const unsigned int num_clusters = *max_cluster_id + 1;
+    //! Add a point to the sums.
+    void add(const box::Box& box, const vec3<float>& point, double mass)
+    {
+        const vec3<float> phase(constants::TWO_PI * box.makeFractional(point));
+        phases[0] += std::polar(mass, double(phase.x));
+        phases[1] += std::polar(mass, double(phase.y));
+        phases[2] += std::polar(mass, double(phase.z));
+        total_mass += mass;
+    }
 
-    // allocate memory for the cluster properties and temporary arrays
-    // initialize arrays to 0
-    m_cluster_centers.prepare(num_clusters);
-    m_cluster_gyrations.prepare({num_clusters, 3, 3});
-    m_cluster_sizes.prepare(num_clusters);
+    //! Add the sums of other points of the same cluster.
+    void join(const CenterSums& other)
+    {
+        for (unsigned int a = 0; a < 3; ++a)
+        {
+            phases[a] += other.phases[a];
+        }
+        total_mass += other.total_mass;
+    }
 
-    // Create a vector to store cluster points, used to compute center of mass
-    std::vector<std::vector<vec3<float>>> cluster_points(num_clusters, std::vector<vec3<float>>());
+    std::complex<double> phases[3] {}; //!< Mass-weighted phase sums in each dimension
+    double total_mass {0};             //!< Total mass
+};
 
-    // Start by determining the center of mass of each cluster. Since we are
-    // given an array of points, the easiest way to do this is to loop over
-    // all points and add the appropriate information to m_cluster_centers as
-    // we go.
-    for (unsigned int i = 0; i < nq->getNPoints(); i++)
+//! Mass-weighted sums of the outer products of displacements from a cluster center.
+struct GyrationSums
+{
+    //! Add the displacement of a point from the center to the sums.
+    void add(const vec3<float>& delta, double mass)
     {
-        const unsigned int c = cluster_idx[i];
-        cluster_points[c].push_back((*nq)[i]);
-        m_cluster_sizes[c]++;
+        const double d[3] = {delta.x, delta.y, delta.z};
+        for (unsigned int a = 0; a < 3; ++a)
+        {
+            for (unsigned int b = a; b < 3; ++b)
+            {
+                second[index(a, b)] += mass * d[a] * d[b];
+            }
+        }
     }
 
-    // Now that we have located all of the cluster vectors, compute the centers
-    for (unsigned int c = 0; c < num_clusters; c++)
+    //! Add the sums of other points of the same cluster.
+    void join(const GyrationSums& other)
     {
-        m_cluster_centers[c] = nq->getBox().centerOfMass(cluster_points[c].data(), m_cluster_sizes[c]);
+        for (unsigned int k = 0; k < 6; ++k)
+        {
+            second[k] += other.second[k];
+        }
     }
 
-    // Now that we have determined the centers of mass for each cluster, tally
-    // up the gyration tensor. This has to be done in a loop over the points.
-    for (unsigned int i = 0; i < nq->getNPoints(); i++)
+    //! Index of the (a, b) component of the symmetric sums, a <= b.
+    static unsigned int index(unsigned int a, unsigned int b)
     {
-        unsigned int c = cluster_idx[i];
-        vec3<float> pos = (*nq)[i];
-        vec3<float> delta = nq->getBox().wrap(pos - m_cluster_centers[c]);
-
-        // get the start pointer for our 3x3 matrix
-        m_cluster_gyrations(c, 0, 0) += delta.x * delta.x;
-        m_cluster_gyrations(c, 0, 1) += delta.x * delta.y;
-        m_cluster_gyrations(c, 0, 2) += delta.x * delta.z;
-        m_cluster_gyrations(c, 1, 0) += delta.y * delta.x;
-        m_cluster_gyrations(c, 1, 1) += delta.y * delta.y;
-        m_cluster_gyrations(c, 1, 2) += delta.y * delta.z;
-        m_cluster_gyrations(c, 2, 0) += delta.z * delta.x;
-        m_cluster_gyrations(c, 2, 1) += delta.z * delta.y;
-        m_cluster_gyrations(c, 2, 2) += delta.z * delta.z;
+        return a * (5 - a) / 2 + b;
     }
 
-    // Normalize by the cluster size.
-    for (unsigned int c = 0; c < num_clusters; c++)
+    double second[6] {}; //!< Upper triangle of the sum of mass-weighted outer products
+};
+
+//! Reduce the slots first to last of the cluster-ordered arrays into sums.
+/*! Large slices are split across tasks. The split does not depend on the
+    number of threads, so the result is reproducible.
+*/
+template<typename Sums, typename Func>
+Sums reduceSlice(unsigned int first, unsigned int last, const Func& add)
+{
+    auto reduce_range = [&add](const tbb::blocked_range<unsigned int>& r, Sums sums) {
+        for (unsigned int slot = r.begin(); slot != r.end(); ++slot)
+        {
+            add(sums, slot);
+        }
+        return sums;
+    };
+    const tbb::blocked_range<unsigned int> range(first, last, SLICE_GRAIN_SIZE);
+    if (last - first <= SLICE_GRAIN_SIZE)
     {
-        auto s = static_cast<float>(m_cluster_sizes[c]);
-        m_cluster_gyrations(c, 0, 0) /= s;
-        m_cluster_gyrations(c, 0, 1) /= s;
-        m_cluster_gyrations(c, 0, 2) /= s;
-        m_cluster_gyrations(c, 1, 0) /= s;
-        m_cluster_gyrations(c, 1, 1) /= s;
-        m_cluster_gyrations(c, 1, 2) /= s;
-        m_cluster_gyrations(c, 2, 0) /= s;
-        m_cluster_gyrations(c, 2, 1) /= s;
-        m_cluster_gyrations(c, 2, 2) /= s;
+        return reduce_range(range, Sums());
     }
+    return tbb::parallel_deterministic_reduce(range, Sums(), reduce_range, [](Sums a, const Sums& b) {
+        a.join(b);
+        return a;
+    });
+}
+
+}; // end anonymous namespace
+
+/*! \param nq NeighborQuery containing the points making up the clusters
+    \param cluster_idx Index of which cluster each point belongs to
+    \param masses Optional mass of each point
+
+    compute sorts the points by cluster in parallel, so that the points of
+    each cluster are contiguous. The clusters are then processed in
+    parallel, with the points of large clusters split across tasks. A first
+    sweep over the points of a cluster finds its mass and center of mass,
+    and a second sweep sums the outer products of the minimum image
+    displacements of its points from the center, which give the gyration
+    tensor, radius of gyration and relative shape anisotropy. The memory
+    used is proportional to the number of points plus the number of
+    clusters.
+*/
+void ClusterProperties::compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx,
+                                const float* masses)
+{
+    const box::Box& box = nq->getBox();
+    const unsigned int n_points = nq->getNPoints();
+
+    // Sort the points by cluster, keeping the points of each cluster sorted
+    // by index.
+    std::vector<uint64_t> sorted_points(n_points);
+    util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            sorted_points[i] = (static_cast<uint64_t>(cluster_idx[i]) << 32) | i;
+        }
+    });
+    tbb::parallel_sort(sorted_points.begin(), sorted_points.end());
+    const unsigned int num_clusters
+        = (n_points == 0) ? 0 : static_cast<unsigned int>(sorted_points.back() >> 32) + 1;
+
+    // The points of cluster c occupy [cluster_offsets[c], cluster_offsets[c+1])
+    // of the cluster-ordered arrays. Each point that starts a cluster sets
+    // the offsets of that cluster and of any empty clusters before it.
+    std::vector<unsigned int> cluster_offsets(num_clusters + 1, n_points);
+    std::vector<vec3<float>> cluster_points(n_points);
+    std::vector<float> cluster_masses((masses != nullptr) ? n_points : 0);
+    util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
+        for (size_t slot = begin; slot < end; ++slot)
+        {
+            const auto c = static_cast<unsigned int>(sorted_points[slot] >> 32);
+            const unsigned int first_c
+                = (slot == 0) ? 0 : static_cast<unsigned int>(sorted_points[slot - 1] >> 32) + 1;
+            for (unsigned int started = first_c; started <= c; ++started)
+            {
+                cluster_offsets[started] = slot;
+            }
+            const auto i = static_cast<unsigned int>(sorted_points[slot]);
+            cluster_points[slot] = (*nq)[i];
+            if (masses != nullptr)
+            {
+                cluster_masses[slot] = masses[i];
+            }
+        }
+    });
+
+    m_cluster_centers.prepare(num_clusters);
+    m_cluster_gyrations.prepare({num_clusters, 3, 3});
+    m_cluster_sizes.prepare(num_clusters);
+    m_cluster_masses.prepare(num_clusters);
+    m_cluster_radii_of_gyration.prepare(num_clusters);
+    m_cluster_anisotropies.prepare(num_clusters);
+
+    auto slot_mass = [&](unsigned int slot) { return (masses != nullptr) ? cluster_masses[slot] : 1.0; };
+
+    util::forLoopWrapper(0, num_clusters, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            const unsigned int first = cluster_offsets[c];
+            const unsigned int last = cluster_offsets[c + 1];
+            m_cluster_sizes[c] = last - first;
+            // Cluster indices without any points keep zeroed properties.
+            if (first == last)
+            {
+                continue;
+            }
+
+            const CenterSums center_sums
+                = reduceSlice<CenterSums>(first, last, [&](CenterSums& sums, unsigned int slot) {
+                      sums.add(box, cluster_points[slot], slot_mass(slot));
+                  });
+            const double total_mass = center_sums.total_mass;
+            m_cluster_masses[c] = static_cast<float>(total_mass);
+            const vec3<float> center = box.wrap(box.makeAbsolute(
+                vec3<float>(static_cast<float>(std::arg(center_sums.phases[0])),
+                            static_cast<float>(std::arg(center_sums.phases[1])),
+                            static_cast<float>(std::arg(center_sums.phases[2])))
+                / constants::TWO_PI));
+            m_cluster_centers[c] = center;
+
+            const GyrationSums gyration_sums
+                = reduceSlice<GyrationSums>(first, last, [&](GyrationSums& sums, unsigned int slot) {
+                      sums.add(box.wrap(cluster_points[slot] - center), slot_mass(slot));
+                  });
+            double gyration[3][3];
+            for (unsigned int a = 0; a < 3; ++a)
+            {
+                for (unsigned int b = a; b < 3; ++b)
+                {
+                    gyration[a][b] = gyration_sums.second[GyrationSums::index(a, b)] / total_mass;
+                    gyration[b][a] = gyration[a][b];
+                }
+            }
+
+            double trace = 0;
+            double trace_squared = 0;
+            for (unsigned int a = 0; a < 3; ++a)
+            {
+                trace += gyration[a][a];
+                for (unsigned int b = 0; b < 3; ++b)
+                {
+                    m_cluster_gyrations(c, a, b) = static_cast<float>(gyration[a][b]);
+                    trace_squared += gyration[a][b] * gyration[b][a];
+                }
+            }
+            m_cluster_radii_of_gyration[c] = static_cast<float>(std::sqrt(std::max(trace, 0.0)));
+
+            // The relative shape anisotropy is 1 - 3 I_2 / I_1^2, where I_1
+            // and I_2 are the first and second invariants of the gyration
+            // tensor. It is 0 for spherically symmetric clusters and 1 for
+            // clusters whose points lie on a line.
+            if (trace > 0)
+            {
+                const double second_invariant = (trace * trace - trace_squared) / 2;
+                m_cluster_anisotropies[c]
+                    = static_cast<float>(1 - 3 * second_invariant / (trace * trace));
+            }
+        }
+    });
 }
 
 }; }; // end namespace freud::cluster
@@ -19,11 +19,22 @@ namespace freud { namespace cluster {
     cluster:
      - Center of mass
      - Gyration tensor
+     - Size and total mass
+     - Radius of gyration
+     - Relative shape anisotropy
 
     m_cluster_centers stores the computed center of mass for each cluster,
     properly handling periodic boundary conditions.
     m_cluster_gyrations stores a 3x3 gyration tensor for each cluster. The
     tensors are symmetric.
+
+    The points are sorted by cluster in parallel, and the clusters are then
+    processed in parallel, with the points of large clusters split across
+    tasks. Centers are circular means of the points' fractional coordinates.
+    Gyration tensors are summed over the minimum image displacements of the
+    points from their cluster center in a second sweep over the points of
+    each cluster, so they are exact for clusters whose points lie within
+    half of the box of their center.
 */
 class ClusterProperties
 {
@@ -32,7 +43,12 @@ public:
     ClusterProperties() = default;
 
     //! Compute properties of the point clusters
-    void compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx);
+    /*! \param nq NeighborQuery containing the points making up the clusters.
+        \param cluster_idx Index of which cluster each point belongs to.
+        \param masses Optional mass of each point, all masses are 1 if not provided.
+    */
+    void compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx,
+                 const float* masses = nullptr);
 
     //! Get a reference to the last computed cluster centers
     const util::ManagedArray<vec3<float>>& getClusterCenters() const
@@ -52,12 +68,33 @@ public:
         return m_cluster_sizes;
     }
 
+    //! Get a reference to the last computed cluster masses
+    const util::ManagedArray<float>& getClusterMasses() const
+    {
+        return m_cluster_masses;
+    }
+
+    //! Get a reference to the last computed cluster radii of gyration
+    const util::ManagedArray<float>& getClusterRadiiOfGyration() const
+    {
+        return m_cluster_radii_of_gyration;
+    }
+
+    //! Get a reference to the last computed relative shape anisotropies
+    const util::ManagedArray<float>& getClusterAnisotropies() const
+    {
+        return m_cluster_anisotropies;
+    }
+
 private:
     util::ManagedArray<vec3<float>>
         m_cluster_centers; //!< Center of mass computed for each cluster (length: m_num_clusters)
     util::ManagedArray<float>
         m_cluster_gyrations; //!< Gyration tensor computed for each cluster (m_num_clusters x 3 x 3 array)
-    util::ManagedArray<unsigned int> m_cluster_sizes; //!< Size per cluster
+    util::ManagedArray<unsigned int> m_cluster_sizes;    //!< Size per cluster
+    util::ManagedArray<float> m_cluster_masses;          //!< Total mass per cluster
+    util::ManagedArray<float> m_cluster_radii_of_gyration; //!< Radius of gyration per cluster
+    util::ManagedArray<float> m_cluster_anisotropies;    //!< Relative shape anisotropy per cluster
 };
 
 }; }; // end namespace freud::cluster
@@ -0,0 +1,205 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_sort.h>
+
+#include "ClusterTracker.h"
+#include "utils.h"
+
+/*! \file ClusterTracker.cc
+    \brief Routines for tracking clusters of points across frames.
+*/
+
+namespace freud { namespace cluster {
+
+namespace {
+
+//! Number of points shared by a current and a previous cluster.
+struct Overlap
+{
+    unsigned int current;
+    unsigned int previous;
+    unsigned int count;
+};
+
+//! Count the points shared by the tracked clusters of consecutive frames.
+/*! The overlaps are returned sorted by current and then previous cluster.
+ */
+std::vector<Overlap> countOverlaps(const util::ManagedArray<unsigned int>& cluster_idx,
+                                   unsigned int num_tracked,
+                                   const std::vector<unsigned int>& previous_cluster_idx,
+                                   unsigned int num_previous_tracked)
+{
+    // Each point in a tracked cluster of both frames is encoded as a
+    // (current, previous) pair, so sorting groups the points of each overlap.
+    tbb::enumerable_thread_specific<std::vector<uint64_t>> local_pairs;
+    util::forLoopWrapper(0, previous_cluster_idx.size(), [&](size_t begin, size_t end) {
+        std::vector<uint64_t>& pairs = local_pairs.local();
+        for (size_t i = begin; i < end; ++i)
+        {
+            const unsigned int current = cluster_idx[i];
+            const unsigned int previous = previous_cluster_idx[i];
+            if (current < num_tracked && previous < num_previous_tracked)
+            {
+                pairs.push_back((static_cast<uint64_t>(current) << 32) | previous);
+            }
+        }
+    });
+    std::vector<uint64_t> pairs;
+    for (const auto& local : local_pairs)
+    {
+        pairs.insert(pairs.end(), local.begin(), local.end());
+    }
+    tbb::parallel_sort(pairs.begin(), pairs.end());
+
+    std::vector<Overlap> overlaps;
+    for (size_t begin = 0; begin < pairs.size();)
+    {
+        size_t end = begin + 1;
+        while (end < pairs.size() && pairs[end] == pairs[begin])
+        {
+            ++end;
+        }
+        overlaps.push_back({static_cast<unsigned int>(pairs[begin] >> 32),
+                            static_cast<unsigned int>(pairs[begin]), static_cast<unsigned int>(end - begin)});
+        begin = end;
+    }
+    return overlaps;
+}
+
+}; // end anonymous namespace
+
+ClusterTracker::ClusterTracker(unsigned int min_size) : m_min_size(min_size)
+{
+    if (min_size == 0)
+    {
+        throw std::invalid_argument("ClusterTracker requires min_size to be positive.");
+    }
+}
+
+void ClusterTracker::reset()
+{
+    m_num_frames = 0;
+    m_next_id = 0;
+    m_previous_cluster_idx.clear();
+    m_previous_cluster_ids.clear();
+    m_events.clear();
+}
+
+void ClusterTracker::compute(const freud::locality::NeighborQuery* nq,
+                             const freud::locality::NeighborList* nlist, freud::locality::QueryArgs qargs)
+{
+    const unsigned int num_points = nq->getNPoints();
+    if (m_num_frames != 0 && num_points != m_previous_cluster_idx.size())
+    {
+        throw std::invalid_argument("ClusterTracker requires the same number of points in every frame.");
+    }
+
+    m_cluster.compute(nq, nlist, qargs);
+    const util::ManagedArray<unsigned int>& cluster_idx = m_cluster.getClusterIdx();
+
+    // Clusters are sorted from largest to smallest, so the tracked clusters
+    // are the first ones.
+    const auto& cluster_keys = m_cluster.getClusterKeys();
+    const auto tracked_end = std::partition_point(
+        cluster_keys.begin(), cluster_keys.end(),
+        [this](const std::vector<unsigned int>& keys) { return keys.size() >= m_min_size; });
+    const auto num_tracked = static_cast<unsigned int>(tracked_end - cluster_keys.begin());
+    m_cluster_ids.prepare(num_tracked);
+    m_events.clear();
+
+    if (m_num_frames == 0)
+    {
+        for (unsigned int c = 0; c < num_tracked; ++c)
+        {
+            m_cluster_ids[c] = m_next_id++;
+        }
+    }
+    else
+    {
+        const auto num_previous_tracked = static_cast<unsigned int>(m_previous_cluster_ids.size());
+        const std::vector<Overlap> overlaps
+            = countOverlaps(cluster_idx, num_tracked, m_previous_cluster_idx, num_previous_tracked);
+
+        // Find the largest overlap of every cluster in both frames. The
+        // overlaps are sorted by index, so ties go to the larger cluster.
+        std::vector<unsigned int> num_previous_overlaps(num_tracked, 0);
+        std::vector<unsigned int> best_previous(num_tracked, num_previous_tracked);
+        std::vector<unsigned int> best_previous_count(num_tracked, 0);
+        std::vector<unsigned int> num_current_overlaps(num_previous_tracked, 0);
+        std::vector<unsigned int> best_current(num_previous_tracked, num_tracked);
+        std::vector<unsigned int> best_current_count(num_previous_tracked, 0);
+        for (const Overlap& overlap : overlaps)
+        {
+            ++num_previous_overlaps[overlap.current];
+            if (overlap.count > best_previous_count[overlap.current])
+            {
+                best_previous_count[overlap.current] = overlap.count;
+                best_previous[overlap.current] = overlap.previous;
+            }
+            ++num_current_overlaps[overlap.previous];
+            if (overlap.count > best_current_count[overlap.previous])
+            {
+                best_current_count[overlap.previous] = overlap.count;
+                best_current[overlap.previous] = overlap.current;
+            }
+        }
+
+        // A cluster keeps the id of its largest overlap in the previous frame
+        // if that cluster's largest overlap is in turn this cluster.
+        for (unsigned int c = 0; c < num_tracked; ++c)
+        {
+            const unsigned int previous = best_previous[c];
+            if (previous != num_previous_tracked && best_current[previous] == c)
+            {
+                m_cluster_ids[c] = m_previous_cluster_ids[previous];
+            }
+            else
+            {
+                m_cluster_ids[c] = m_next_id++;
+            }
+        }
+
+        for (unsigned int c = 0; c < num_tracked; ++c)
+        {
+            if (num_previous_overlaps[c] == 0)
+            {
+                m_events.push_back({ClusterEventType::birth, 0, m_cluster_ids[c]});
+            }
+        }
+        for (unsigned int p = 0; p < num_previous_tracked; ++p)
+        {
+            if (num_current_overlaps[p] == 0)
+            {
+                m_events.push_back({ClusterEventType::death, m_previous_cluster_ids[p], 0});
+            }
+        }
+        for (const Overlap& overlap : overlaps)
+        {
+            if (num_previous_overlaps[overlap.current] > 1)
+            {
+                m_events.push_back({ClusterEventType::merge, m_previous_cluster_ids[overlap.previous],
+                                    m_cluster_ids[overlap.current]});
+            }
+        }
+        for (const Overlap& overlap : overlaps)
+        {
+            if (num_current_overlaps[overlap.previous] > 1)
+            {
+                m_events.push_back({ClusterEventType::split, m_previous_cluster_ids[overlap.previous],
+                                    m_cluster_ids[overlap.current]});
+            }
+        }
+    }
+
+    // Keep the labels of this frame to match against the next one.
+    m_previous_cluster_idx.assign(cluster_idx.get(), cluster_idx.get() + num_points);
+    m_previous_cluster_ids.assign(m_cluster_ids.get(), m_cluster_ids.get() + num_tracked);
+    ++m_num_frames;
+}
+
+}; }; // end namespace freud::cluster
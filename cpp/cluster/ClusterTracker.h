@@ -0,0 +1,125 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef CLUSTER_TRACKER_H
+#define CLUSTER_TRACKER_H
+
+#include <vector>
+
+#include "Cluster.h"
+#include "ManagedArray.h"
+#include "NeighborList.h"
+#include "NeighborQuery.h"
+
+/*! \file ClusterTracker.h
+    \brief Routines for tracking clusters of points across frames.
+*/
+
+namespace freud { namespace cluster {
+
+//! Enumeration for types of cluster events between consecutive frames.
+enum ClusterEventType
+{
+    birth, //! A cluster that does not overlap any cluster of the previous frame.
+    death, //! A cluster of the previous frame that does not overlap any current cluster.
+    merge, //! A cluster that overlaps several clusters of the previous frame.
+    split, //! A cluster of the previous frame that overlaps several current clusters.
+};
+
+//! An event relating clusters of consecutive frames.
+struct ClusterEvent
+{
+    ClusterEventType type;    //!< Type of the event
+    unsigned int previous_id; //!< Persistent id of the previous cluster, unused for births
+    unsigned int current_id;  //!< Persistent id of the current cluster, unused for deaths
+};
+
+//! Tracks clusters of points across the frames of a trajectory.
+/*! Every frame is clustered with Cluster. Clusters with at least min_size
+ *  points are tracked and receive persistent ids that carry over between
+ *  frames. The points are assumed to be the same in every frame, so the
+ *  clusters of consecutive frames are matched by the number of points they
+ *  share. A current cluster continues a previous cluster (and keeps its id) if
+ *  each is the other's largest overlap. All other tracked clusters receive new
+ *  ids.
+ *
+ *  Starting with the second frame, compute also records the births, deaths,
+ *  merges and splits of tracked clusters since the previous frame. A merge
+ *  produces one event for every previous cluster that overlaps the merged
+ *  cluster, and a split produces one event for every current cluster that
+ *  overlaps the split cluster.
+ */
+class ClusterTracker
+{
+public:
+    //! Constructor
+    /*! \param min_size Minimum number of points in a tracked cluster.
+     */
+    explicit ClusterTracker(unsigned int min_size = 1);
+
+    //! Compute the clusters of the next frame and match them to the previous frame.
+    void compute(const freud::locality::NeighborQuery* nq, const freud::locality::NeighborList* nlist,
+                 freud::locality::QueryArgs qargs);
+
+    //! Forget the previous frame, so the next frame starts a new trajectory.
+    void reset();
+
+    //! Get the minimum number of points in a tracked cluster.
+    unsigned int getMinSize() const
+    {
+        return m_min_size;
+    }
+
+    //! Get the number of frames computed since construction or the last reset.
+    unsigned int getNumFrames() const
+    {
+        return m_num_frames;
+    }
+
+    //! Get the total number of clusters in the current frame.
+    unsigned int getNumClusters() const
+    {
+        return m_cluster.getNumClusters();
+    }
+
+    //! Get the number of tracked clusters in the current frame.
+    /*! Clusters are sorted by size, so the tracked clusters are the first
+     *  clusters of the current frame.
+     */
+    unsigned int getNumTrackedClusters() const
+    {
+        return static_cast<unsigned int>(m_cluster_ids.size());
+    }
+
+    //! Get a reference to the cluster index of each point in the current frame.
+    const util::ManagedArray<unsigned int>& getClusterIdx() const
+    {
+        return m_cluster.getClusterIdx();
+    }
+
+    //! Get a reference to the persistent id of each tracked cluster.
+    const util::ManagedArray<unsigned int>& getClusterIds() const
+    {
+        return m_cluster_ids;
+    }
+
+    //! Get the events since the previous frame.
+    const std::vector<ClusterEvent>& getEvents() const
+    {
+        return m_events;
+    }
+
+private:
+    unsigned int m_min_size;                          //!< Minimum size of a tracked cluster
+    unsigned int m_num_frames {0};                    //!< Number of frames since the last reset
+    unsigned int m_next_id {0};                       //!< Next unused persistent cluster id
+    Cluster m_cluster;                                //!< Clusters of the current frame
+    util::ManagedArray<unsigned int> m_cluster_ids;   //!< Persistent id of each tracked cluster
+    std::vector<unsigned int> m_previous_cluster_idx; //!< Cluster index of each point in the previous frame
+    std::vector<unsigned int> m_previous_cluster_ids; //!< Persistent ids of the previous tracked clusters
+    std::vector<ClusterEvent> m_events;               //!< Events since the previous frame
+};
+
+}; }; // end namespace freud::cluster
+
+#endif // CLUSTER_TRACKER_H
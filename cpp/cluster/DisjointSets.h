@@ -0,0 +1,104 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef DISJOINT_SETS_H
+#define DISJOINT_SETS_H
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "utils.h"
+
+/*! \file DisjointSets.h
+    \brief Concurrent disjoint set (union-find) data structure.
+*/
+
+namespace freud { namespace cluster {
+
+//! Wait-free disjoint sets that support concurrent find and unite calls
+/*! Each element stores the index of its parent in an atomic integer. Sets are
+    merged by linking the root with the larger index below the root with the
+    smaller index (union by index), so every parent index is smaller than the
+    index of its child. Parent indices therefore only ever decrease, which
+    keeps the forest acyclic under any interleaving of concurrent operations
+    and makes the root of every set the smallest element in that set.
+
+    Trees are kept shallow with path halving: find points each visited element
+    at its grandparent using a compare-and-swap that may fail harmlessly if
+    another thread has already moved the element closer to the root.
+
+    Concurrent calls to find and unite are safe, e.g. from inside a TBB
+    parallel loop. The results of find are only guaranteed to be final once
+    all calls to unite have completed.
+*/
+class DisjointSets
+{
+public:
+    //! Constructor
+    /*! \param size Number of elements, each of which starts in its own set.
+     */
+    explicit DisjointSets(unsigned int size) : m_parents(size)
+    {
+        util::forLoopWrapper(0, size, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                m_parents[i].store(static_cast<unsigned int>(i), std::memory_order_relaxed);
+            }
+        });
+    }
+
+    //! Find the root of the set containing an element
+    unsigned int find(unsigned int id) const
+    {
+        unsigned int parent = m_parents[id].load(std::memory_order_relaxed);
+        while (parent != id)
+        {
+            unsigned int grandparent = m_parents[parent].load(std::memory_order_relaxed);
+            if (grandparent != parent)
+            {
+                // Path halving. A failed exchange means that another thread
+                // already replaced the parent with a smaller index.
+                unsigned int expected = parent;
+                m_parents[id].compare_exchange_weak(expected, grandparent, std::memory_order_relaxed);
+            }
+            id = parent;
+            parent = grandparent;
+        }
+        return id;
+    }
+
+    //! Merge the sets containing two elements
+    /*! \returns Whether the elements were in different sets.
+     */
+    bool unite(unsigned int id1, unsigned int id2)
+    {
+        while (true)
+        {
+            id1 = find(id1);
+            id2 = find(id2);
+            if (id1 == id2)
+            {
+                return false;
+            }
+            if (id1 < id2)
+            {
+                std::swap(id1, id2);
+            }
+            // Link the larger root below the smaller one, retrying if id1
+            // stopped being a root since it was found.
+            unsigned int expected = id1;
+            if (m_parents[id1].compare_exchange_strong(expected, id2, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+private:
+    mutable std::vector<std::atomic<unsigned int>> m_parents; //!< Parent index of each element
+};
+
+}; }; // end namespace freud::cluster
+
+#endif // DISJOINT_SETS_H
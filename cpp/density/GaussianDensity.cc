@@ -1,10 +1,18 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <complex>
 #include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
+#include <vector>
+
+#include "Eigen/unsupported/Eigen/FFT"
 
 #include "GaussianDensity.h"
+#include "utils.h"
 
 /*! \file GaussianDensity.cc
     \brief Routines for computing Gaussian smeared densities from points.
@@ -12,8 +20,220 @@
 
 namespace freud { namespace density {
 
-GaussianDensity::GaussianDensity(vec3<unsigned int> width, float r_max, float sigma)
-    : m_box(), m_width(width), m_r_max(r_max), m_sigma(sigma), m_has_computed(false)
+namespace {
+
+//! Division of one axis of the grid into tiles.
+/*! Every tile is at least twice as wide as the halo, so two tiles with one
+ *  tile between them do not overlap, even including their halos. The tiles
+ *  are colored alternately. With an odd number of tiles the last tile gets a
+ *  third color, since it neighbors the first tile through the periodic
+ *  boundary.
+ */
+struct TileAxis
+{
+    TileAxis(unsigned int width, unsigned int halo, unsigned int min_tile_width)
+    {
+        const unsigned int tile_width = std::max(min_tile_width, 4 * halo);
+        num_tiles = std::max(1U, width / tile_width);
+        num_colors = (num_tiles == 1) ? 1 : (num_tiles % 2 == 0 ? 2 : 3);
+        starts.resize(num_tiles + 1);
+        tile_of_bin.resize(width);
+        for (unsigned int t = 0; t <= num_tiles; ++t)
+        {
+            starts[t] = static_cast<unsigned int>(static_cast<size_t>(t) * width / num_tiles);
+        }
+        for (unsigned int t = 0; t < num_tiles; ++t)
+        {
+            std::fill(tile_of_bin.begin() + starts[t], tile_of_bin.begin() + starts[t + 1], t);
+        }
+    }
+
+    unsigned int color(unsigned int tile) const
+    {
+        return (num_colors == 3 && tile == num_tiles - 1) ? 2 : tile % 2;
+    }
+
+    unsigned int num_tiles;                //!< Number of tiles along the axis.
+    unsigned int num_colors;               //!< Number of tile colors along the axis.
+    std::vector<unsigned int> starts;      //!< First bin of each tile, followed by the width.
+    std::vector<unsigned int> tile_of_bin; //!< Tile containing each bin.
+};
+
+//! Home bin of a point along one axis of the grid.
+/*! Along periodic axes the home bin is the bin wrapped into the grid, and
+ *  shift is the number of bins it was moved by. Along aperiodic axes points
+ *  outside the grid are assigned to the nearest bin, and only bins inside
+ *  the grid are evaluated.
+ */
+inline unsigned int homeBin(int bin, unsigned int width, bool periodic, int& shift)
+{
+    const int w = static_cast<int>(width);
+    const int home = periodic ? ((bin % w) + w) % w : std::min(std::max(bin, 0), w - 1);
+    shift = periodic ? bin - home : 0;
+    return static_cast<unsigned int>(home);
+}
+
+//! Relative cost of adding one bin of the stencil of a point in the separable method.
+constexpr double SEPARABLE_COST = 1.0;
+
+//! Relative cost per bin of the FFT method, in units of fftAxisCost.
+constexpr double FFT_COST = 4.0;
+
+//! Minimum width of the Gaussian in bins for which the FFT method is chosen automatically.
+/*! The error of the B-spline assignment is about 1e-3 of the peak of a
+ *  Gaussian for sigma of two bin widths and 5e-5 for four bin widths.
+ */
+constexpr float FFT_MIN_SIGMA_BINS = 4.0;
+
+//! Minimum cutoff in units of sigma for which the FFT method is chosen automatically.
+/*! The FFT method applies the cutoff to the offsets between bins rather than
+ *  to the distances from the points, so near the cutoff its result differs
+ *  from the direct method by the Gaussian at r_max, which is 3e-4 of its peak
+ *  at four sigma.
+ */
+constexpr float FFT_MIN_CUTOFF_SIGMAS = 4.0;
+
+//! Number of bins along each axis that a point is assigned to by the FFT method.
+constexpr int BSPLINE_ORDER = 4;
+
+//! Relative cost per element of a one-dimensional FFT of length n.
+/*! Factors of two, three and five are handled by specialized butterflies,
+ *  while larger prime factors use a generic butterfly whose cost grows with
+ *  the factor.
+ */
+double fftAxisCost(unsigned int n)
+{
+    double cost = 0;
+    for (unsigned int factor = 2; factor * factor <= n; ++factor)
+    {
+        while (n % factor == 0)
+        {
+            cost += (factor <= 5) ? 0.5 * factor : factor;
+            n /= factor;
+        }
+    }
+    if (n > 1)
+    {
+        cost += (n <= 5) ? 0.5 * n : n;
+    }
+    return cost;
+}
+
+//! Cubic B-spline weights of the four bins nearest to a point along one axis.
+/*! \param bin_coordinate Coordinate of the point in units of bins, with bin b spanning [b, b + 1).
+ *  \param first_bin Set to the first of the four bins.
+ *  \param weights Set to the weights of the four bins, which sum to one.
+ */
+inline void bsplineWeights(float bin_coordinate, int& first_bin, float* weights)
+{
+    const float u = bin_coordinate - float(0.5);
+    const float floor_u = std::floor(u);
+    const float t = u - floor_u;
+    const float s = float(1.0) - t;
+    first_bin = static_cast<int>(floor_u) - 1;
+    weights[0] = s * s * s / float(6.0);
+    weights[1] = (float(4.0) - float(6.0) * t * t + float(3.0) * t * t * t) / float(6.0);
+    weights[2] = (float(4.0) - float(6.0) * s * s + float(3.0) * s * s * s) / float(6.0);
+    weights[3] = t * t * t / float(6.0);
+}
+
+//! Buffer accumulating the contributions to one tile of the grid and its halo.
+struct TileBuffer
+{
+    //! Cover the bins from origin to origin + extent and set them to zero.
+    void reset(const vec3<int>& new_origin, const vec3<unsigned int>& new_extent)
+    {
+        origin = new_origin;
+        extent = new_extent;
+        data.assign(static_cast<size_t>(extent.x) * extent.y * extent.z, 0);
+    }
+
+    //! Get the row of bins (i, j, k) in the buffer, starting from k = origin.z.
+    float* row(int i, int j)
+    {
+        return data.data() + (static_cast<size_t>(i - origin.x) * extent.y + (j - origin.y)) * extent.z;
+    }
+
+    vec3<int> origin;          //!< First bin of the buffer.
+    vec3<unsigned int> extent; //!< Number of bins of the buffer along each axis.
+    std::vector<float> data;   //!< Accumulated values.
+};
+
+//! Distances and Gaussian factors from a point to consecutive bins along one axis.
+struct AxisFactors
+{
+    std::vector<float> dist_sq;  //!< Squared distance to each bin.
+    std::vector<float> gaussian; //!< Gaussian factor of each bin.
+};
+
+//! Discrete Fourier transform of a grid along each of its axes.
+/*! The grid is stored in row-major order with the z index fastest. Axes of
+ *  width one are left untouched. The inverse transform is normalized.
+ */
+void transformGrid(std::vector<std::complex<float>>& grid, const vec3<unsigned int>& width, bool inverse)
+{
+    tbb::enumerable_thread_specific<Eigen::FFT<float>> local_ffts;
+    tbb::enumerable_thread_specific<std::vector<std::complex<float>>> local_lines;
+    const unsigned int widths[3] = {width.x, width.y, width.z};
+    const size_t strides[3] = {static_cast<size_t>(width.y) * width.z, width.z, 1};
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        const unsigned int n = widths[axis];
+        const size_t stride = strides[axis];
+        if (n == 1)
+        {
+            continue;
+        }
+        util::forLoopWrapper(0, grid.size() / n, [&](size_t begin, size_t end) {
+            Eigen::FFT<float>& fft = local_ffts.local();
+            std::vector<std::complex<float>>& line = local_lines.local();
+            line.resize(2 * static_cast<size_t>(n));
+            for (size_t line_idx = begin; line_idx < end; ++line_idx)
+            {
+                const size_t first = (line_idx / stride) * stride * n + line_idx % stride;
+                for (unsigned int m = 0; m < n; ++m)
+                {
+                    line[m] = grid[first + m * stride];
+                }
+                if (inverse)
+                {
+                    fft.inv(line.data() + n, line.data(), n);
+                }
+                else
+                {
+                    fft.fwd(line.data() + n, line.data(), n);
+                }
+                for (unsigned int m = 0; m < n; ++m)
+                {
+                    grid[first + m * stride] = line[n + m];
+                }
+            }
+        });
+    }
+}
+
+//! Transform of the B-spline assignment along an axis of the grid.
+/*! The cubic B-spline is the box function of one bin convolved with itself
+ *  four times, so its transform is sinc^4(pi m / n) at the discrete
+ *  frequency m, folded into [-n/2, n/2]. An axis of width one is not
+ *  assigned, so its window is one.
+ */
+std::vector<float> bsplineWindow(unsigned int n)
+{
+    std::vector<float> window(n, 1);
+    for (unsigned int m = 1; m < n; ++m)
+    {
+        const double x = M_PI * std::min(m, n - m) / n;
+        const double sinc_sq = (std::sin(x) / x) * (std::sin(x) / x);
+        window[m] = static_cast<float>(sinc_sq * sinc_sq);
+    }
+    return window;
+}
+
+} // end anonymous namespace
+
+GaussianDensity::GaussianDensity(vec3<unsigned int> width, float r_max, float sigma, GaussianDensityMode mode)
+    : m_box(), m_width(width), m_r_max(r_max), m_sigma(sigma), m_mode(mode), m_has_computed(false)
 {
     if (r_max <= 0)
     {
@@ -33,6 +253,227 @@ vec3<unsigned int> GaussianDensity::getWidth()
     return m_width;
 }
 
+GaussianDensityMode GaussianDensity::chooseMode(unsigned int n_points) const
+{
+    const bool orthorhombic = m_box.getTiltFactorXY() == 0
+        && (m_box.is2D() || (m_box.getTiltFactorXZ() == 0 && m_box.getTiltFactorYZ() == 0));
+    const vec3<bool> periodic = m_box.getPeriodic();
+    const bool fully_periodic = periodic.x && periodic.y && (m_box.is2D() || periodic.z);
+
+    if (m_mode == Separable && !orthorhombic)
+    {
+        throw std::invalid_argument("The separable GaussianDensity mode requires an orthorhombic box.");
+    }
+    if (m_mode == FFT && !(orthorhombic && fully_periodic))
+    {
+        throw std::invalid_argument("The FFT GaussianDensity mode requires a periodic orthorhombic box.");
+    }
+    if (m_mode != Auto)
+    {
+        return m_mode;
+    }
+
+    if (!orthorhombic)
+    {
+        return Direct;
+    }
+
+    // The FFT method is only used when the Gaussian is wide enough for the
+    // B-spline assignment to be accurate, the cutoff is far enough out that
+    // applying it to the bin offsets changes little, and the cutoff sphere
+    // fits in the box. It is then chosen if its cost, which mostly depends
+    // on the grid, is less than the cost of adding the stencil of every
+    // point.
+    const float grid_size_x = m_box.getLx() / m_width.x;
+    const float grid_size_y = m_box.getLy() / m_width.y;
+    const float grid_size_z = m_box.is2D() ? 0 : m_box.getLz() / m_width.z;
+    const float max_grid_size = std::max(std::max(grid_size_x, grid_size_y), grid_size_z);
+    const float min_length = m_box.is2D() ? std::min(m_box.getLx(), m_box.getLy())
+                                          : std::min(std::min(m_box.getLx(), m_box.getLy()), m_box.getLz());
+    if (!fully_periodic || m_sigma < FFT_MIN_SIGMA_BINS * max_grid_size
+        || m_r_max < FFT_MIN_CUTOFF_SIGMAS * m_sigma || float(2.0) * m_r_max > min_length)
+    {
+        return Separable;
+    }
+    const double stencil_x = 2 * int(m_r_max / grid_size_x) + 1;
+    const double stencil_y = 2 * int(m_r_max / grid_size_y) + 1;
+    const double stencil_z = m_box.is2D() ? 1 : 2 * int(m_r_max / grid_size_z) + 1;
+    const double stencil_bins = stencil_x * stencil_y * stencil_z;
+    const double bspline_bins = std::pow(BSPLINE_ORDER, m_box.is2D() ? 2 : 3);
+    const double num_bins = static_cast<double>(m_width.x) * m_width.y * m_width.z;
+    const double separable_cost = SEPARABLE_COST * n_points * stencil_bins;
+    const double fft_cost = SEPARABLE_COST * n_points * bspline_bins
+        + FFT_COST * num_bins * (fftAxisCost(m_width.x) + fftAxisCost(m_width.y) + fftAxisCost(m_width.z));
+    return (fft_cost < separable_cost) ? FFT : Separable;
+}
+
+template<typename Func>
+void GaussianDensity::accumulateTiles(const vec3<float>* points, unsigned int n_points, const vec3<int>& halo,
+                                      const Func& splat)
+{
+    const float Lx = m_box.getLx();
+    const float Ly = m_box.getLy();
+    const float Lz = m_box.getLz();
+    const vec3<bool> periodic = m_box.getPeriodic();
+
+    const float grid_size_x = Lx / m_width.x;
+    const float grid_size_y = Ly / m_width.y;
+    const float grid_size_z = m_box.is2D() ? 0 : Lz / m_width.z;
+
+    // Tiles of a 2D grid are flat, so they are made wider.
+    const unsigned int min_tile_width = m_box.is2D() ? 64 : 32;
+    const TileAxis tiles_x(m_width.x, halo.x, min_tile_width);
+    const TileAxis tiles_y(m_width.y, halo.y, min_tile_width);
+    const TileAxis tiles_z(m_width.z, halo.z, min_tile_width);
+    const unsigned int num_tiles = tiles_x.num_tiles * tiles_y.num_tiles * tiles_z.num_tiles;
+
+    // Find which bin each point is in.
+    auto point_bin = [&](const vec3<float>& point) {
+        const int bin_x = int((point.x + Lx / float(2.0)) / grid_size_x);
+        const int bin_y = int((point.y + Ly / float(2.0)) / grid_size_y);
+        // In 2D, only loop over the z=0 plane
+        const int bin_z = m_box.is2D() ? 0 : int((point.z + Lz / float(2.0)) / grid_size_z);
+        return vec3<int>(bin_x, bin_y, bin_z);
+    };
+
+    // Sort the points by the tile containing their bin.
+    std::vector<unsigned int> point_tiles(n_points);
+    util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx)
+        {
+            const vec3<int> bin = point_bin(points[idx]);
+            int shift;
+            const unsigned int tile_x = tiles_x.tile_of_bin[homeBin(bin.x, m_width.x, periodic.x, shift)];
+            const unsigned int tile_y = tiles_y.tile_of_bin[homeBin(bin.y, m_width.y, periodic.y, shift)];
+            const unsigned int tile_z = tiles_z.tile_of_bin[homeBin(bin.z, m_width.z, periodic.z, shift)];
+            point_tiles[idx] = (tile_x * tiles_y.num_tiles + tile_y) * tiles_z.num_tiles + tile_z;
+        }
+    });
+    std::vector<unsigned int> tile_starts(num_tiles + 1, 0);
+    for (const unsigned int tile : point_tiles)
+    {
+        ++tile_starts[tile + 1];
+    }
+    for (unsigned int tile = 0; tile < num_tiles; ++tile)
+    {
+        tile_starts[tile + 1] += tile_starts[tile];
+    }
+    std::vector<unsigned int> tile_points(n_points);
+    {
+        std::vector<unsigned int> tile_fill(tile_starts.begin(), tile_starts.end() - 1);
+        for (unsigned int idx = 0; idx < n_points; ++idx)
+        {
+            tile_points[tile_fill[point_tiles[idx]]++] = idx;
+        }
+    }
+
+    // Accumulate the points of one tile into a buffer covering the tile and
+    // its halo, and add the buffer into the density.
+    tbb::enumerable_thread_specific<TileBuffer> local_buffers;
+    auto accumulate_tile = [&](unsigned int tile_x, unsigned int tile_y, unsigned int tile_z) {
+        const unsigned int tile = (tile_x * tiles_y.num_tiles + tile_y) * tiles_z.num_tiles + tile_z;
+        if (tile_starts[tile] == tile_starts[tile + 1])
+        {
+            return;
+        }
+
+        TileBuffer& buffer = local_buffers.local();
+        buffer.reset(vec3<int>(static_cast<int>(tiles_x.starts[tile_x]) - halo.x,
+                               static_cast<int>(tiles_y.starts[tile_y]) - halo.y,
+                               static_cast<int>(tiles_z.starts[tile_z]) - halo.z),
+                     vec3<unsigned int>(tiles_x.starts[tile_x + 1] - tiles_x.starts[tile_x] + 2 * halo.x,
+                                        tiles_y.starts[tile_y + 1] - tiles_y.starts[tile_y] + 2 * halo.y,
+                                        tiles_z.starts[tile_z + 1] - tiles_z.starts[tile_z] + 2 * halo.z));
+
+        for (unsigned int p = tile_starts[tile]; p < tile_starts[tile + 1]; ++p)
+        {
+            const unsigned int idx = tile_points[p];
+            const vec3<float> point = points[idx];
+            const vec3<int> bin = point_bin(point);
+            vec3<int> shift;
+            homeBin(bin.x, m_width.x, periodic.x, shift.x);
+            homeBin(bin.y, m_width.y, periodic.y, shift.y);
+            homeBin(bin.z, m_width.z, periodic.z, shift.z);
+            splat(idx, point, bin, shift, buffer);
+        }
+
+        // Assure that out of range indices are corrected for storage in the
+        // array i.e. bin -1 is actually bin 29 for nbins = 30. Bins outside
+        // the grid along aperiodic axes were never written.
+        auto global_bins = [](int origin, unsigned int extent, unsigned int width, bool periodic_axis) {
+            std::vector<int> bins(extent);
+            for (unsigned int b = 0; b < extent; ++b)
+            {
+                const int bin = origin + static_cast<int>(b);
+                const int w = static_cast<int>(width);
+                bins[b] = periodic_axis ? ((bin % w) + w) % w : ((bin < 0 || bin >= w) ? -1 : bin);
+            }
+            return bins;
+        };
+        const vec3<unsigned int>& extent = buffer.extent;
+        const std::vector<int> bins_x = global_bins(buffer.origin.x, extent.x, m_width.x, periodic.x);
+        const std::vector<int> bins_y = global_bins(buffer.origin.y, extent.y, m_width.y, periodic.y);
+        const std::vector<int> bins_z = global_bins(buffer.origin.z, extent.z, m_width.z, periodic.z);
+        for (unsigned int a = 0; a < extent.x; ++a)
+        {
+            if (bins_x[a] < 0)
+            {
+                continue;
+            }
+            for (unsigned int b = 0; b < extent.y; ++b)
+            {
+                if (bins_y[b] < 0)
+                {
+                    continue;
+                }
+                const size_t density_row
+                    = (static_cast<size_t>(bins_x[a]) * m_width.y + bins_y[b]) * m_width.z;
+                const float* buffer_row = buffer.row(buffer.origin.x + a, buffer.origin.y + b);
+                for (unsigned int c = 0; c < extent.z; ++c)
+                {
+                    if (bins_z[c] >= 0)
+                    {
+                        m_density_array[density_row + bins_z[c]] += buffer_row[c];
+                    }
+                }
+            }
+        }
+    };
+
+    // Tiles of the same color never write to the same bins, so each color is
+    // processed in parallel.
+    for (unsigned int color_x = 0; color_x < tiles_x.num_colors; ++color_x)
+    {
+        for (unsigned int color_y = 0; color_y < tiles_y.num_colors; ++color_y)
+        {
+            for (unsigned int color_z = 0; color_z < tiles_z.num_colors; ++color_z)
+            {
+                std::vector<vec3<unsigned int>> color_tiles;
+                for (unsigned int tile_x = 0; tile_x < tiles_x.num_tiles; ++tile_x)
+                {
+                    for (unsigned int tile_y = 0; tile_y < tiles_y.num_tiles; ++tile_y)
+                    {
+                        for (unsigned int tile_z = 0; tile_z < tiles_z.num_tiles; ++tile_z)
+                        {
+                            if (tiles_x.color(tile_x) == color_x && tiles_y.color(tile_y) == color_y
+                                && tiles_z.color(tile_z) == color_z)
+                            {
+                                color_tiles.emplace_back(tile_x, tile_y, tile_z);
+                            }
+                        }
+                    }
+                }
+                util::forLoopWrapper(0, color_tiles.size(), [&](size_t begin, size_t end) {
+                    for (size_t t = begin; t < end; ++t)
+                    {
+                        accumulate_tile(color_tiles[t].x, color_tiles[t].y, color_tiles[t].z);
+                    }
+                });
+            }
+        }
+    }
+}
+
 //! Compute the density array.
 void GaussianDensity::compute(const freud::locality::NeighborQuery* nq, const float* values)
 {
@@ -58,8 +499,9 @@ void GaussianDensity::compute(const freud::locality::NeighborQuery* nq, const fl
         m_width.z = 1;
     }
 
+    const GaussianDensityMode mode = chooseMode(n_points);
+
     m_density_array.prepare({m_width.x, m_width.y, m_width.z});
-    util::ThreadStorage<float> local_bin_counts({m_width.x, m_width.y, m_width.z});
 
     // set up some constants first
     const float Lx = m_box.getLx();
@@ -75,58 +517,48 @@ void GaussianDensity::compute(const freud::locality::NeighborQuery* nq, const fl
     const int bin_cut_x = int(m_r_max / grid_size_x);
     const int bin_cut_y = int(m_r_max / grid_size_y);
     const int bin_cut_z = m_box.is2D() ? 0 : int(m_r_max / grid_size_z);
+    const vec3<int> bin_cut(bin_cut_x, bin_cut_y, bin_cut_z);
     const float r_max_sq = m_r_max * m_r_max;
     const float sigmasq = m_sigma * m_sigma;
     const float normalization_base = float(1.0) / std::sqrt(constants::TWO_PI * sigmasq);
     const float dimensions = m_box.is2D() ? float(2.0) : float(3.0);
     const float normalization = std::pow(normalization_base, dimensions);
 
-    util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
-        // for each reference point
-        for (size_t idx = begin; idx < end; ++idx)
-        {
-            const vec3<float> point = (*nq)[idx];
-            const float value = (values != nullptr) ? values[idx] : 1.0f;
-
-            // Find which bin the particle is in
-            int bin_x = int((point.x + Lx / float(2.0)) / grid_size_x);
-            int bin_y = int((point.y + Ly / float(2.0)) / grid_size_y);
-            int bin_z = int((point.z + Lz / float(2.0)) / grid_size_z);
+    // Reject bins that are outside the box in aperiodic directions
+    // Only evaluate over bins that are within the cutoff
+    auto cutoff_bins = [=](const vec3<int>& bin, vec3<int>& bin_min, vec3<int>& bin_max) {
+        bin_min.x = periodic.x ? bin.x - bin_cut_x : std::max(bin.x - bin_cut_x, 0);
+        bin_max.x = periodic.x ? bin.x + bin_cut_x : std::min(bin.x + bin_cut_x, int(m_width.x) - 1);
+        bin_min.y = periodic.y ? bin.y - bin_cut_y : std::max(bin.y - bin_cut_y, 0);
+        bin_max.y = periodic.y ? bin.y + bin_cut_y : std::min(bin.y + bin_cut_y, int(m_width.y) - 1);
+        bin_min.z = periodic.z ? bin.z - bin_cut_z : std::max(bin.z - bin_cut_z, 0);
+        bin_max.z = periodic.z ? bin.z + bin_cut_z : std::min(bin.z + bin_cut_z, int(m_width.z) - 1);
+    };
 
-            // In 2D, only loop over the z=0 plane
-            if (m_box.is2D())
-            {
-                bin_z = 0;
-            }
+    if (mode == Direct)
+    {
+        auto direct_splat = [=](unsigned int idx, const vec3<float>& point, const vec3<int>& bin,
+                                const vec3<int>& shift, TileBuffer& buffer) {
+            const float value = (values != nullptr) ? values[idx] : 1.0f;
+            vec3<int> bin_min;
+            vec3<int> bin_max;
+            cutoff_bins(bin, bin_min, bin_max);
 
-            // Reject bins that are outside the box in aperiodic directions
-            // Only evaluate over bins that are within the cutoff
-            for (int k = bin_z - bin_cut_z; k <= bin_z + bin_cut_z; k++)
+            for (int i = bin_min.x; i <= bin_max.x; i++)
             {
-                if (!periodic.z && (k < 0 || k >= int(m_width.z)))
-                {
-                    continue;
-                }
-                const float dz = (grid_size_z * static_cast<float>(k)) + (grid_size_z / float(2.0)) - point.z
-                    - (Lz / float(2.0));
+                const float dx = (grid_size_x * static_cast<float>(i)) + (grid_size_x / float(2.0)) - point.x
+                    - (Lx / float(2.0));
 
-                for (int j = bin_y - bin_cut_y; j <= bin_y + bin_cut_y; j++)
+                for (int j = bin_min.y; j <= bin_max.y; j++)
                 {
-                    if (!periodic.y && (j < 0 || j >= int(m_width.y)))
-                    {
-                        continue;
-                    }
                     const float dy = (grid_size_y * static_cast<float>(j)) + (grid_size_y / float(2.0))
                         - point.y - (Ly / float(2.0));
+                    float* buffer_row = buffer.row(i - shift.x, j - shift.y);
 
-                    for (int i = bin_x - bin_cut_x; i <= bin_x + bin_cut_x; i++)
+                    for (int k = bin_min.z; k <= bin_max.z; k++)
                     {
-                        if (!periodic.x && (i < 0 || i >= int(m_width.x)))
-                        {
-                            continue;
-                        }
-                        const float dx = (grid_size_x * static_cast<float>(i)) + (grid_size_x / float(2.0))
-                            - point.x - (Lx / float(2.0));
+                        const float dz = (grid_size_z * static_cast<float>(k)) + (grid_size_z / float(2.0))
+                            - point.z - (Lz / float(2.0));
 
                         // Calculate the distance from the particle to the grid cell
                         const vec3<float> delta = m_box.wrap(vec3<float>(dx, dy, dz));
@@ -140,23 +572,188 @@ void GaussianDensity::compute(const freud::locality::NeighborQuery* nq, const fl
                             const float gaussian
                                 = value * normalization * std::exp(-r_sq / (float(2.0) * sigmasq));
 
-                            // Assure that out of range indices are corrected for storage
-                            // in the array i.e. bin -1 is actually bin 29 for nbins = 30
-                            const unsigned int ni = (i + m_width.x) % m_width.x;
-                            const unsigned int nj = (j + m_width.y) % m_width.y;
-                            const unsigned int nk = (k + m_width.z) % m_width.z;
-
                             // Store the gaussian contribution
-                            local_bin_counts.local()(ni, nj, nk) += gaussian;
+                            buffer_row[k - shift.z - buffer.origin.z] += gaussian;
                         }
                     }
                 }
             }
+        };
+        accumulateTiles(nq->getPoints(), n_points, bin_cut, direct_splat);
+    }
+    else if (mode == Separable)
+    {
+        // In an orthorhombic box the squared distance and the Gaussian are a
+        // sum and a product of terms for each axis, which are computed once
+        // per point for the bins within the cutoff along that axis.
+        tbb::enumerable_thread_specific<std::array<AxisFactors, 3>> local_factors;
+        auto axis_factors = [=](int bin_min, int bin_max, float grid_size, float L, float coordinate,
+                                const vec3<float>& axis, AxisFactors& factors) {
+            factors.dist_sq.resize(bin_max - bin_min + 1);
+            factors.gaussian.resize(bin_max - bin_min + 1);
+            for (int b = bin_min; b <= bin_max; ++b)
+            {
+                const float d = (grid_size * static_cast<float>(b)) + (grid_size / float(2.0)) - coordinate
+                    - (L / float(2.0));
+                const vec3<float> delta = m_box.wrap(d * axis);
+                const float d_sq = dot(delta, delta);
+                factors.dist_sq[b - bin_min] = d_sq;
+                factors.gaussian[b - bin_min] = std::exp(-d_sq / (float(2.0) * sigmasq));
+            }
+        };
+        auto separable_splat = [=, &local_factors](unsigned int idx, const vec3<float>& point,
+                                                   const vec3<int>& bin, const vec3<int>& shift,
+                                                   TileBuffer& buffer) {
+            const float value = (values != nullptr) ? values[idx] : 1.0f;
+            vec3<int> bin_min;
+            vec3<int> bin_max;
+            cutoff_bins(bin, bin_min, bin_max);
+
+            std::array<AxisFactors, 3>& factors = local_factors.local();
+            axis_factors(bin_min.x, bin_max.x, grid_size_x, Lx, point.x, vec3<float>(1, 0, 0), factors[0]);
+            axis_factors(bin_min.y, bin_max.y, grid_size_y, Ly, point.y, vec3<float>(0, 1, 0), factors[1]);
+            axis_factors(bin_min.z, bin_max.z, grid_size_z, Lz, point.z, vec3<float>(0, 0, 1), factors[2]);
+            const float* dist_sq_z = factors[2].dist_sq.data();
+            const float* gaussian_z = factors[2].gaussian.data();
+            const int num_z = bin_max.z - bin_min.z + 1;
+
+            for (int i = bin_min.x; i <= bin_max.x; i++)
+            {
+                const float dx_sq = factors[0].dist_sq[i - bin_min.x];
+                const float gaussian_x = value * normalization * factors[0].gaussian[i - bin_min.x];
+
+                for (int j = bin_min.y; j <= bin_max.y; j++)
+                {
+                    const float r_xy_sq = dx_sq + factors[1].dist_sq[j - bin_min.y];
+                    if (r_xy_sq >= r_max_sq)
+                    {
+                        continue;
+                    }
+                    const float gaussian_xy = gaussian_x * factors[1].gaussian[j - bin_min.y];
+                    float* buffer_row
+                        = buffer.row(i - shift.x, j - shift.y) + (bin_min.z - shift.z - buffer.origin.z);
+
+                    for (int c = 0; c < num_z; c++)
+                    {
+                        if (r_xy_sq + dist_sq_z[c] < r_max_sq)
+                        {
+                            buffer_row[c] += gaussian_xy * gaussian_z[c];
+                        }
+                    }
+                }
+            }
+        };
+        accumulateTiles(nq->getPoints(), n_points, bin_cut, separable_splat);
+    }
+    else
+    {
+        // Assign the points to the grid with cubic B-spline weights over the
+        // four nearest bins along each axis. The points are wrapped into the
+        // box so that these bins are within two bins of the bin containing
+        // the point.
+        std::vector<vec3<float>> wrapped_points(n_points);
+        util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
+            for (size_t idx = begin; idx < end; ++idx)
+            {
+                wrapped_points[idx] = m_box.wrap((*nq)[idx]);
+            }
+        });
+        auto bspline_splat = [=](unsigned int idx, const vec3<float>& point, const vec3<int>& /*bin*/,
+                                 const vec3<int>& shift, TileBuffer& buffer) {
+            const float value = (values != nullptr) ? values[idx] : 1.0f;
+            vec3<int> first_bin(0, 0, 0);
+            float weights_x[BSPLINE_ORDER];
+            float weights_y[BSPLINE_ORDER];
+            float weights_z[BSPLINE_ORDER] = {1, 0, 0, 0};
+            bsplineWeights((point.x + Lx / float(2.0)) / grid_size_x, first_bin.x, weights_x);
+            bsplineWeights((point.y + Ly / float(2.0)) / grid_size_y, first_bin.y, weights_y);
+            if (!m_box.is2D())
+            {
+                bsplineWeights((point.z + Lz / float(2.0)) / grid_size_z, first_bin.z, weights_z);
+            }
+            const int num_z = m_box.is2D() ? 1 : BSPLINE_ORDER;
+            for (int a = 0; a < BSPLINE_ORDER; ++a)
+            {
+                for (int b = 0; b < BSPLINE_ORDER; ++b)
+                {
+                    float* buffer_row = buffer.row(first_bin.x + a - shift.x, first_bin.y + b - shift.y)
+                        + (first_bin.z - shift.z - buffer.origin.z);
+                    const float weight_xy = value * weights_x[a] * weights_y[b];
+                    for (int c = 0; c < num_z; ++c)
+                    {
+                        buffer_row[c] += weight_xy * weights_z[c];
+                    }
+                }
+            }
+        };
+        const int halo = BSPLINE_ORDER / 2;
+        accumulateTiles(wrapped_points.data(), n_points, vec3<int>(halo, halo, m_box.is2D() ? 0 : halo),
+                        bspline_splat);
+
+        // Sample the Gaussian at the offsets between bins within the cutoff,
+        // using the same minimum image distances as the direct method.
+        const size_t num_bins = m_density_array.size();
+        std::vector<std::complex<float>> kernel(num_bins, 0);
+        auto wrap_bin = [](int bin, unsigned int width) {
+            const int w = static_cast<int>(width);
+            return static_cast<size_t>(((bin % w) + w) % w);
+        };
+        for (int i = -bin_cut_x; i <= bin_cut_x; ++i)
+        {
+            const float dx = grid_size_x * static_cast<float>(i);
+            for (int j = -bin_cut_y; j <= bin_cut_y; ++j)
+            {
+                const float dy = grid_size_y * static_cast<float>(j);
+                const size_t kernel_row
+                    = (wrap_bin(i, m_width.x) * m_width.y + wrap_bin(j, m_width.y)) * m_width.z;
+                for (int k = -bin_cut_z; k <= bin_cut_z; ++k)
+                {
+                    const float dz = grid_size_z * static_cast<float>(k);
+                    const vec3<float> delta = m_box.wrap(vec3<float>(dx, dy, dz));
+                    const float r_sq = dot(delta, delta);
+                    if (r_sq < r_max_sq)
+                    {
+                        kernel[kernel_row + wrap_bin(k, m_width.z)]
+                            += normalization * std::exp(-r_sq / (float(2.0) * sigmasq));
+                    }
+                }
+            }
         }
-    });
 
-    // Parallel reduction over thread storage
-    local_bin_counts.reduceInto(m_density_array);
+        // Convolve the assigned points with the sampled Gaussian, whose
+        // transform is real because the Gaussian is even. The assignment
+        // convolves the points with the B-spline, so dividing by the
+        // transform of the B-spline, the product of sinc^4 over the axes,
+        // removes the smoothing of the assignment.
+        const std::vector<float> window_x = bsplineWindow(m_width.x);
+        const std::vector<float> window_y = bsplineWindow(m_width.y);
+        const std::vector<float> window_z = bsplineWindow(m_width.z);
+        std::vector<std::complex<float>> grid(num_bins);
+        util::forLoopWrapper(0, num_bins, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b)
+            {
+                grid[b] = m_density_array[b];
+            }
+        });
+        transformGrid(grid, m_width, false);
+        transformGrid(kernel, m_width, false);
+        util::forLoopWrapper(0, num_bins, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b)
+            {
+                const size_t i = b / (static_cast<size_t>(m_width.y) * m_width.z);
+                const size_t j = (b / m_width.z) % m_width.y;
+                const size_t k = b % m_width.z;
+                grid[b] *= kernel[b].real() / (window_x[i] * window_y[j] * window_z[k]);
+            }
+        });
+        transformGrid(grid, m_width, true);
+        util::forLoopWrapper(0, num_bins, [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b)
+            {
+                m_density_array[b] = grid[b].real();
+            }
+        });
+    }
 }
 
 }; }; // end namespace freud::density
@@ -7,7 +7,6 @@
 #include "Box.h"
 #include "ManagedArray.h"
 #include "NeighborQuery.h"
-#include "ThreadStorage.h"
 #include "VectorMath.h"
 
 /*! \file GaussianDensity.h
@@ -16,16 +15,47 @@
 
 namespace freud { namespace density {
 
+//! Method used to evaluate the Gaussians on the grid.
+enum GaussianDensityMode
+{
+    Auto,      //!< Choose the fastest accurate method for the box and grid.
+    Direct,    //!< Evaluate the Gaussian of every point at every bin within the cutoff.
+    Separable, //!< Form the Gaussian of every point from per-axis factors (orthorhombic boxes).
+    FFT        //!< Convolve the binned points with the Gaussian (periodic orthorhombic boxes).
+};
+
 //! Computes the density of a system on a grid.
 /*! Replaces particle positions with a gaussian and calculates the
         contribution from the grid based upon the distance of the grid cell
         from the center of the Gaussian.
+
+        The grid is divided into tiles, and each point is assigned to the
+        tile containing its grid cell. A task accumulates the points of one
+        tile into a thread-local buffer covering the tile and a halo of the
+        cutoff width, then adds the buffer into the density. Tiles are colored
+        so that tiles of the same color, including their halos, never overlap,
+        and the colors are processed one after another. The memory used is
+        therefore one grid plus one tile buffer per thread.
+
+        In orthorhombic boxes the Gaussian factorizes along the axes, so the
+        separable method evaluates one exponential per axis and bin instead of
+        one per bin in the cutoff volume, giving the same result as the direct
+        method up to rounding. In periodic orthorhombic boxes the FFT method
+        assigns the points to the grid with cubic B-spline weights, convolves
+        the grid with the Gaussian sampled at the bin offsets, and divides out
+        the transform of the B-spline. Its cost does not depend on the
+        cutoff. Its errors are about 1e-3 of the peak of a Gaussian for sigma
+        of two bin widths and fall rapidly with sigma, apart from differences
+        near the cutoff, which it applies to the offsets between bins. The
+        automatic mode chooses the cheaper of the separable and FFT methods,
+        only considering the FFT method when sigma is at least four bin widths
+        and the cutoff at least four sigma.
 */
 class GaussianDensity
 {
 public:
     //! Constructor
-    GaussianDensity(vec3<unsigned int> width, float r_max, float sigma);
+    GaussianDensity(vec3<unsigned int> width, float r_max, float sigma, GaussianDensityMode mode);
 
     // Destructor
     ~GaussianDensity() = default;
@@ -48,6 +78,12 @@ public:
         return m_r_max;
     }
 
+    //! Get the method used to evaluate the Gaussians.
+    GaussianDensityMode getMode() const
+    {
+        return m_mode;
+    }
+
     //! Compute the density.
     void compute(const freud::locality::NeighborQuery* nq, const float* values = nullptr);
 
@@ -57,10 +93,24 @@ public:
     vec3<unsigned int> getWidth();
 
 private:
+    //! Choose the method used for the current box and points.
+    GaussianDensityMode chooseMode(unsigned int n_points) const;
+
+    //! Add the contributions of the points to the density, one tile of the grid at a time.
+    /*! \param points Points to add.
+     *  \param n_points Number of points.
+     *  \param halo Number of bins around its own bin that a point contributes to along each axis.
+     *  \param splat Function adding the contribution of a point to a tile buffer.
+     */
+    template<typename Func>
+    void accumulateTiles(const vec3<float>* points, unsigned int n_points, const vec3<int>& halo,
+                         const Func& splat);
+
     box::Box m_box;             //!< Simulation box containing the points.
     vec3<unsigned int> m_width; //!< Number of bins in the grid in each dimension.
     float m_r_max;              //!< Max distance at which to compute density.
     float m_sigma;              //!< Gaussian width sigma.
+    GaussianDensityMode m_mode; //!< Method used to evaluate the Gaussians.
     bool m_has_computed;        //!< Tracks whether a call to compute has been made.
 
     util::ManagedArray<float> m_density_array; //! Computed density array.
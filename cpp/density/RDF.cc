@@ -83,10 +83,15 @@ void RDF::accumulate(const freud::locality::NeighborQuery* neighbor_query, const
                      unsigned int n_query_points, const freud::locality::NeighborList* nlist,
                      freud::locality::QueryArgs qargs)
 {
+    // A half list holds each pair of points once, so every bond also stands
+    // for its reverse bond and is counted twice.
+    const bool half_list = (nlist != nullptr) ? nlist->getHalfList() : qargs.half_list;
+    const util::Weight<unsigned int> bond_weight(half_list ? 2 : 1);
     accumulateGeneral(neighbor_query, query_points, n_query_points, nlist, qargs,
                       [=](const freud::locality::NeighborBond& neighbor_bond) {
-                          m_local_histograms(neighbor_bond.distance);
-                      });
+                          m_local_histograms(neighbor_bond.distance, bond_weight);
+                      },
+                      true);
 }
 
 }; }; // end namespace freud::density
@@ -1,10 +1,14 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 #include "SphereVoxelization.h"
+#include "utils.h"
 
 /*! \file SphereVoxelization.cc
     \brief Routines for computing voxelized densities from spheres centered at points.
@@ -12,6 +16,126 @@
 
 namespace freud { namespace density {
 
+namespace {
+
+//! Number of voxels packed into each word of a row.
+constexpr unsigned int WORD_BITS = 32;
+
+//! Get the coordinate of a vector along an axis.
+inline float component(const vec3<float>& v, unsigned int axis)
+{
+    return (axis == 0) ? v.x : ((axis == 1) ? v.y : v.z);
+}
+
+//! Set the bits of the voxels first to last, inclusive, of a row.
+inline void setBits(unsigned int* row, unsigned int first, unsigned int last)
+{
+    const unsigned int first_word = first / WORD_BITS;
+    const unsigned int last_word = last / WORD_BITS;
+    const unsigned int first_mask = ~0U << (first % WORD_BITS);
+    const unsigned int last_mask = ~0U >> (WORD_BITS - 1 - last % WORD_BITS);
+    if (first_word == last_word)
+    {
+        row[first_word] |= first_mask & last_mask;
+        return;
+    }
+    row[first_word] |= first_mask;
+    std::fill(row + first_word + 1, row + last_word, ~0U);
+    row[last_word] |= last_mask;
+}
+
+//! Set the bits of the voxels first to last, inclusive, of a periodic row.
+/*! The indices may lie outside the row, and are wrapped into it.
+ */
+inline void setPeriodicBits(unsigned int* row, int first, int last, unsigned int width)
+{
+    const int w = static_cast<int>(width);
+    if (last - first + 1 >= w)
+    {
+        setBits(row, 0, width - 1);
+        return;
+    }
+    const int wrapped_first = ((first % w) + w) % w;
+    const int wrapped_last = wrapped_first + (last - first);
+    if (wrapped_last < w)
+    {
+        setBits(row, wrapped_first, wrapped_last);
+    }
+    else
+    {
+        setBits(row, wrapped_first, w - 1);
+        setBits(row, 0, wrapped_last - w);
+    }
+}
+
+//! Home bin of a point along one axis of the grid.
+/*! Along periodic axes the home bin is the bin wrapped into the grid. Along
+ *  aperiodic axes points outside the grid are assigned to the nearest bin.
+ */
+inline unsigned int homeBin(int bin, unsigned int width, bool periodic)
+{
+    const int w = static_cast<int>(width);
+    return static_cast<unsigned int>(periodic ? ((bin % w) + w) % w : std::min(std::max(bin, 0), w - 1));
+}
+
+//! Call a function for each range of bins of the grid within bin_cut of a bin along one axis.
+/*! Along periodic axes the bins are wrapped into the grid, which splits them
+ *  into at most two ranges that visit each bin at most once. Along aperiodic
+ *  axes bins outside the grid are skipped.
+ */
+template<typename Func>
+inline void forEachNearbyRange(int bin, int bin_cut, unsigned int width, bool periodic, const Func& func)
+{
+    const int w = static_cast<int>(width);
+    if (periodic && 2 * bin_cut + 1 >= w)
+    {
+        func(0, w - 1);
+    }
+    else if (periodic)
+    {
+        const int first = (((bin - bin_cut) % w) + w) % w;
+        const int last = first + 2 * bin_cut;
+        if (last < w)
+        {
+            func(first, last);
+        }
+        else
+        {
+            func(first, w - 1);
+            func(0, last - w);
+        }
+    }
+    else if (bin - bin_cut < w && bin + bin_cut >= 0)
+    {
+        func(std::max(bin - bin_cut, 0), std::min(bin + bin_cut, w - 1));
+    }
+}
+
+//! Call a function for each image of a grid index within bin_cut of a bin along one axis.
+/*! Images differ from the index by multiples of the width along periodic
+ *  axes, while along aperiodic axes the only image is the index itself.
+ */
+template<typename Func>
+inline void forEachImage(int index, int bin, int bin_cut, unsigned int width, bool periodic, const Func& func)
+{
+    if (!periodic)
+    {
+        if (std::abs(index - bin) <= bin_cut)
+        {
+            func(index);
+        }
+        return;
+    }
+    const int w = static_cast<int>(width);
+    for (int image = bin - bin_cut + (((index - bin + bin_cut) % w) + w) % w; image <= bin + bin_cut;
+         image += w)
+    {
+        func(image);
+    }
+}
+
+} // end anonymous namespace
+
 SphereVoxelization::SphereVoxelization(vec3<unsigned int> width, float r_max)
     : m_box(), m_width(width), m_r_max(r_max), m_has_computed(false)
 {
@@ -22,9 +146,9 @@ SphereVoxelization::SphereVoxelization(vec3<unsigned int> width, float r_max)
 }
 
 //! Get a reference to the last computed voxels.
-const util::ManagedArray<unsigned int>& SphereVoxelization::getVoxels() const
+const util::ManagedArray<unsigned int>& SphereVoxelization::getVoxelBits() const
 {
-    return m_voxels_array;
+    return m_voxel_bits;
 }
 
 //! Get width.
@@ -58,85 +182,210 @@ void SphereVoxelization::compute(const freud::locality::NeighborQuery* nq)
         m_width.z = 1;
     }
 
-    m_voxels_array.prepare({m_width.x, m_width.y, m_width.z});
+    // The axes x, y and z are numbered 0, 1 and 2. Voxels are packed into
+    // rows along the row axis, and rows are indexed by their bins along the x
+    // axis and the outer axis. In 2D the outer axis is the z axis of width 1.
+    const unsigned int row_axis = m_box.is2D() ? 1 : 2;
+    const unsigned int outer_axis = m_box.is2D() ? 2 : 1;
 
     // set up some constants first
-    const float Lx = m_box.getLx();
-    const float Ly = m_box.getLy();
-    const float Lz = m_box.getLz();
-    const vec3<bool> periodic = m_box.getPeriodic();
-
-    const float grid_size_x = Lx / m_width.x;
-    const float grid_size_y = Ly / m_width.y;
-    const float grid_size_z = m_box.is2D() ? 0 : Lz / m_width.z;
-
-    // Find the number of bins within r_max
-    const int bin_cut_x = int(m_r_max / grid_size_x);
-    const int bin_cut_y = int(m_r_max / grid_size_y);
-    const int bin_cut_z = m_box.is2D() ? 0 : int(m_r_max / grid_size_z);
+    const std::array<float, 3> length = {m_box.getLx(), m_box.getLy(), m_box.getLz()};
+    const std::array<unsigned int, 3> width = {m_width.x, m_width.y, m_width.z};
+    const vec3<bool> periodic_vec = m_box.getPeriodic();
+    const std::array<bool, 3> periodic = {periodic_vec.x, periodic_vec.y, periodic_vec.z};
+    const bool orthorhombic = m_box.getTiltFactorXY() == 0
+        && (m_box.is2D() || (m_box.getTiltFactorXZ() == 0 && m_box.getTiltFactorYZ() == 0));
+
+    std::array<float, 3> grid_size {};
+    std::array<int, 3> bin_cut {};
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+        // In 2D, only the z=0 plane is used
+        grid_size[axis] = (m_box.is2D() && axis == 2) ? 0 : length[axis] / width[axis];
+        // Find the number of bins within r_max. A voxel center within r_max
+        // of a point can be one bin further away than that.
+        bin_cut[axis] = (grid_size[axis] > 0) ? int(m_r_max / grid_size[axis]) + 1 : 0;
+    }
     const float r_max_sq = m_r_max * m_r_max;
 
+    // Find which bin a coordinate is in, and the distance from a coordinate
+    // to the center of a bin. Coordinates outside the box are assigned to
+    // the bins outside the grid that contain them.
+    auto coordinate_bin = [&](float coordinate, unsigned int axis) {
+        if (grid_size[axis] == 0)
+        {
+            return 0;
+        }
+        return static_cast<int>(std::floor((coordinate + length[axis] / float(2.0)) / grid_size[axis]));
+    };
+    auto bin_distance = [&](int bin, float coordinate, unsigned int axis) {
+        return (grid_size[axis] * static_cast<float>(bin)) + (grid_size[axis] / float(2.0)) - coordinate
+            - (length[axis] / float(2.0));
+    };
+
+    // Sort the points by the row containing their bin.
+    const unsigned int num_rows = width[0] * width[outer_axis];
+    std::vector<unsigned int> point_rows(n_points);
     util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
-        // for each reference point
         for (size_t idx = begin; idx < end; ++idx)
         {
             const vec3<float> point = (*nq)[idx];
-            // Find which bin the particle is in
-            const int bin_x = int((point.x + Lx / float(2.0)) / grid_size_x);
-            const int bin_y = int((point.y + Ly / float(2.0)) / grid_size_y);
-            // In 2D, only loop over the z=0 plane
-            const int bin_z = m_box.is2D() ? 0 : int((point.z + Lz / float(2.0)) / grid_size_z);
-
-            // Only evaluate over bins that are within the cutoff, rejecting bins
-            // that are outside the box in aperiodic directions.
-            for (int k = bin_z - bin_cut_z; k <= bin_z + bin_cut_z; k++)
-            {
-                if (!periodic.z && (k < 0 || k >= int(m_width.z)))
-                {
-                    continue;
-                }
-                const float dz = (grid_size_z * static_cast<float>(k)) + (grid_size_z / float(2.0)) - point.z
-                    - (Lz / float(2.0));
+            const int bin_x = coordinate_bin(point.x, 0);
+            const int bin_outer = coordinate_bin(component(point, outer_axis), outer_axis);
+            point_rows[idx] = homeBin(bin_x, width[0], periodic[0]) * width[outer_axis]
+                + homeBin(bin_outer, width[outer_axis], periodic[outer_axis]);
+        }
+    });
+    std::vector<unsigned int> row_starts(num_rows + 1, 0);
+    for (const unsigned int row : point_rows)
+    {
+        ++row_starts[row + 1];
+    }
+    for (unsigned int row = 0; row < num_rows; ++row)
+    {
+        row_starts[row + 1] += row_starts[row];
+    }
+    std::vector<vec3<float>> row_points(n_points);
+    {
+        std::vector<unsigned int> row_fill(row_starts.begin(), row_starts.end() - 1);
+        for (unsigned int idx = 0; idx < n_points; ++idx)
+        {
+            row_points[row_fill[point_rows[idx]]++] = (*nq)[idx];
+        }
+    }
 
-                for (int j = bin_y - bin_cut_y; j <= bin_y + bin_cut_y; j++)
-                {
-                    if (!periodic.y && (j < 0 || j >= int(m_width.y)))
-                    {
-                        continue;
-                    }
-                    const float dy = (grid_size_y * static_cast<float>(j)) + (grid_size_y / float(2.0))
-                        - point.y - (Ly / float(2.0));
+    const unsigned int row_width = width[row_axis];
+    const unsigned int num_words = (row_width + WORD_BITS - 1) / WORD_BITS;
+    if (m_box.is2D())
+    {
+        m_voxel_bits.prepare({m_width.x, num_words});
+    }
+    else
+    {
+        m_voxel_bits.prepare({m_width.x, m_width.y, num_words});
+    }
+
+    // Add a sphere to a row of an orthorhombic box, in which the distance
+    // along each axis is wrapped separately. The voxels in the sphere are
+    // those within a half extent of the point along the row.
+    auto wrap_axis = [&](float distance, unsigned int axis) {
+        if (!periodic[axis] || length[axis] == 0)
+        {
+            return distance;
+        }
+        return distance - length[axis] * std::floor(distance / length[axis] + float(0.5));
+    };
+    auto add_orthorhombic = [&](unsigned int* row_bits, int row_x, int row_outer, const vec3<float>& point) {
+        const float dx = wrap_axis(bin_distance(row_x, point.x, 0), 0);
+        const float d_outer
+            = wrap_axis(bin_distance(row_outer, component(point, outer_axis), outer_axis), outer_axis);
+        const float remaining_sq = r_max_sq - dx * dx - d_outer * d_outer;
+        if (remaining_sq <= 0)
+        {
+            return;
+        }
 
-                    for (int i = bin_x - bin_cut_x; i <= bin_x + bin_cut_x; i++)
+        // Voxel k of the row is in the sphere if |k - center| < half_extent,
+        // measured in bins.
+        const float half_extent = std::sqrt(remaining_sq) / grid_size[row_axis];
+        const float center
+            = (component(point, row_axis) + length[row_axis] / float(2.0)) / grid_size[row_axis] - float(0.5);
+        int first = static_cast<int>(std::floor(center - half_extent)) + 1;
+        int last = static_cast<int>(std::ceil(center + half_extent)) - 1;
+        if (periodic[row_axis])
+        {
+            if (first <= last)
+            {
+                setPeriodicBits(row_bits, first, last, row_width);
+            }
+        }
+        else
+        {
+            first = std::max(first, 0);
+            last = std::min(last, static_cast<int>(row_width) - 1);
+            if (first <= last)
+            {
+                setBits(row_bits, first, last);
+            }
+        }
+    };
+
+    // Add a sphere to a row of a triclinic box, testing the wrapped distance
+    // to each voxel of the row near the point. Periodic images of the row
+    // within the cutoff of the point are each tested.
+    auto add_triclinic = [&](unsigned int* row_bits, int row_x, int row_outer, const vec3<float>& point) {
+        const int bin_x = coordinate_bin(point.x, 0);
+        const int bin_outer = coordinate_bin(component(point, outer_axis), outer_axis);
+        const int bin_row = coordinate_bin(component(point, row_axis), row_axis);
+        forEachImage(row_x, bin_x, bin_cut[0], width[0], periodic[0], [&](int image_x) {
+            forEachImage(
+                row_outer, bin_outer, bin_cut[outer_axis], width[outer_axis], periodic[outer_axis],
+                [&](int image_outer) {
+                    std::array<float, 3> delta;
+                    delta[0] = bin_distance(image_x, point.x, 0);
+                    delta[outer_axis] = bin_distance(image_outer, component(point, outer_axis), outer_axis);
+                    // Reject bins that are outside the box in aperiodic directions
+                    const int k_min = periodic[row_axis] ? bin_row - bin_cut[row_axis]
+                                                         : std::max(bin_row - bin_cut[row_axis], 0);
+                    const int k_max = periodic[row_axis]
+                        ? bin_row + bin_cut[row_axis]
+                        : std::min(bin_row + bin_cut[row_axis], static_cast<int>(row_width) - 1);
+                    for (int k = k_min; k <= k_max; ++k)
                     {
-                        if (!periodic.x && (i < 0 || i >= int(m_width.x)))
-                        {
-                            continue;
-                        }
-                        const float dx = ((grid_size_x * static_cast<float>(i)) + (grid_size_x / 2.0f)
-                                          - point.x - (Lx / float(2.0)));
+                        delta[row_axis] = bin_distance(k, component(point, row_axis), row_axis);
 
                         // Calculate the distance from the particle to the grid cell
-                        const vec3<float> delta = m_box.wrap(vec3<float>(dx, dy, dz));
-
-                        const float r_sq = dot(delta, delta);
+                        const vec3<float> wrapped = m_box.wrap(vec3<float>(delta[0], delta[1], delta[2]));
 
                         // Check to see if this distance is within the specified r_max
-                        if (r_sq < r_max_sq)
+                        if (dot(wrapped, wrapped) < r_max_sq)
                         {
                             // Assure that out of range indices are corrected for storage
                             // in the array i.e. bin -1 is actually bin 29 for nbins = 30
-                            const unsigned int ni = (i + m_width.x) % m_width.x;
-                            const unsigned int nj = (j + m_width.y) % m_width.y;
-                            const unsigned int nk = (k + m_width.z) % m_width.z;
-
-                            // This array value could be written by multiple threads in parallel.
-                            // This is only safe because all threads are writing the same value (1).
-                            m_voxels_array(ni, nj, nk) = 1;
+                            const unsigned int nk = homeBin(k, row_width, true);
+                            row_bits[nk / WORD_BITS] |= 1U << (nk % WORD_BITS);
                         }
                     }
+                });
+        });
+    };
+
+    // Each row is only written by the task filling it, from the points in the
+    // rows within the cutoff.
+    util::forLoopWrapper(0, num_rows, [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row)
+        {
+            const int row_x = static_cast<int>(row / width[outer_axis]);
+            const int row_outer = static_cast<int>(row % width[outer_axis]);
+            unsigned int* row_bits = m_voxel_bits.get() + row * num_words;
+
+            auto add_points = [&](unsigned int first_row, unsigned int last_row) {
+                for (unsigned int p = row_starts[first_row]; p < row_starts[last_row + 1]; ++p)
+                {
+                    if (orthorhombic)
+                    {
+                        add_orthorhombic(row_bits, row_x, row_outer, row_points[p]);
+                    }
+                    else
+                    {
+                        add_triclinic(row_bits, row_x, row_outer, row_points[p]);
+                    }
                 }
-            }
+            };
+
+            // The points of consecutive rows along the outer axis are stored
+            // consecutively, so they are visited a range of rows at a time.
+            forEachNearbyRange(row_x, bin_cut[0], width[0], periodic[0], [&](int first_x, int last_x) {
+                for (int bin_x = first_x; bin_x <= last_x; ++bin_x)
+                {
+                    const unsigned int x_rows = bin_x * width[outer_axis];
+                    forEachNearbyRange(
+                        row_outer, bin_cut[outer_axis], width[outer_axis], periodic[outer_axis],
+                        [&](int first_outer, int last_outer) {
+                            add_points(x_rows + first_outer, x_rows + last_outer);
+                        });
+                }
+            });
         }
     });
 }
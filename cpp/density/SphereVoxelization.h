@@ -22,6 +22,14 @@ namespace freud { namespace density {
     otherwise. The dimensions of the grid are set in the constructor, and can
     either be set equally for all dimensions or for each dimension
     independently.
+
+    The voxels are stored as bits, packed into 32-bit words along rows of the
+    last axis of the grid (z in 3D and y in 2D). Each row is filled by a
+    single task from the spheres of the points binned near the row, so no
+    voxel is written by two threads. In orthorhombic boxes a sphere covers a
+    contiguous run of voxels in a row, whose ends follow from the distance
+    between the row and the center of the sphere, so the voxels are set a word
+    at a time instead of being tested one by one.
 */
 class SphereVoxelization
 {
@@ -47,8 +55,12 @@ public:
     //! Compute the voxelization.
     void compute(const freud::locality::NeighborQuery* nq);
 
-    //! Get a reference to the last computed voxels.
-    const util::ManagedArray<unsigned int>& getVoxels() const;
+    //! Get a reference to the last computed voxels, packed into bits.
+    /*! The array has shape (w_x, w_y, n_words) in 3D and (w_x, n_words) in
+     *  2D, where a row of n_words words holds the voxels along the last axis
+     *  of the grid. Voxel k of a row is bit k % 32 of word k / 32.
+     */
+    const util::ManagedArray<unsigned int>& getVoxelBits() const;
 
     vec3<unsigned int> getWidth() const;
 
@@ -58,7 +70,7 @@ private:
     float m_r_max;              //!< Sphere radius used for voxelization.
     bool m_has_computed;        //!< Tracks whether a call to compute has been made.
 
-    util::ManagedArray<unsigned int> m_voxels_array; //! Computed voxels array.
+    util::ManagedArray<unsigned int> m_voxel_bits; //!< Computed voxels packed into bits along rows.
 };
 
 }; }; // end namespace freud::density
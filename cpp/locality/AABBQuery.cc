@@ -27,7 +27,7 @@ AABBQuery::querySingle(const vec3<float> query_point, unsigned int query_point_i
     if (args.mode == QueryType::ball)
     {
         return std::make_shared<AABBQueryBallIterator>(this, query_point, query_point_idx, args.r_max,
-                                                       args.r_min, args.exclude_ii);
+                                                       args.r_min, args.exclude_ii, true, args.half_list);
     }
     if (args.mode == QueryType::nearest)
     {
@@ -43,34 +43,144 @@ void AABBQuery::setupTree(unsigned int Np)
     m_aabbs.resize(Np);
 }
 
+void AABBQuery::makeAABBs()
+{
+    for (unsigned int slot = 0; slot < m_leaf_tags.size(); ++slot)
+    {
+        // Make a point AABB, indexed by the point
+        const unsigned int i = m_leaf_tags[slot];
+        m_aabbs[i] = AABB(m_leaf_points[slot], i);
+    }
+}
+
 void AABBQuery::buildTree(const vec3<float>* points, unsigned int Np)
 {
-    // Construct a point AABB for each point
-    for (unsigned int i = 0; i < Np; ++i)
+    // The positions used in the tree
+    std::vector<vec3<float>> tree_points(points, points + Np);
+    if (m_box.is2D())
     {
-        // Make a point AABB
-        vec3<float> my_pos(points[i]);
-        if (m_box.is2D())
+        for (auto& point : tree_points)
         {
-            my_pos.z = 0;
+            point.z = 0;
         }
-        m_aabbs[i] = AABB(my_pos, i);
+    }
+
+    // Construct a point AABB for each point
+    for (unsigned int i = 0; i < Np; ++i)
+    {
+        m_aabbs[i] = AABB(tree_points[i], i);
     }
 
     // Call the tree build routine, one tree per type
     m_aabb_tree.buildTree(m_aabbs.data(), Np);
+    m_build_surface_area = m_aabb_tree.getSurfaceArea();
+    updateLeafOrder(tree_points);
 }
 
-void AABBIterator::updateImageVectors(float r_max, bool _check_r_max)
+void AABBQuery::updateLeafOrder(const std::vector<vec3<float>>& tree_points)
+{
+    // Input points are often in no particular spatial order. Copying them in
+    // the order of the leaves makes every leaf a contiguous block of memory,
+    // and nearby leaves hold nearby points because the tree is built by
+    // splitting space. Nodes are stored in pre-order, so the points below
+    // any node also form a contiguous block starting at its offset.
+    const unsigned int num_nodes = m_aabb_tree.getNumNodes();
+    m_node_offsets.resize(num_nodes);
+    m_leaf_tags.clear();
+    m_leaf_tags.reserve(tree_points.size());
+    m_leaf_points.clear();
+    m_leaf_points.reserve(tree_points.size());
+    for (unsigned int node_idx = 0; node_idx < num_nodes; ++node_idx)
+    {
+        m_node_offsets[node_idx] = m_leaf_tags.size();
+        for (unsigned int p = 0; p < m_aabb_tree.getNodeNumParticles(node_idx); ++p)
+        {
+            const unsigned int j = m_aabb_tree.getNodeParticleTag(node_idx, p);
+            m_leaf_tags.push_back(j);
+            m_leaf_points.push_back(tree_points[j]);
+        }
+    }
+}
+
+bool AABBQuery::updatePoints(const vec3<float>* points, unsigned int n_points, float max_area_ratio)
+{
+    const bool same_size = (n_points == m_n_points);
+    setPoints(points, n_points);
+
+    if (!same_size)
+    {
+        setupTree(m_n_points);
+        buildTree(m_points, m_n_points);
+        return true;
+    }
+
+    // Move each tree point to the periodic image of its new position that is
+    // closest to its previous position, so that points crossing a periodic
+    // boundary do not stretch their leaf across the box. Queries only check
+    // neighboring images, so the tree is rebuilt if any point leaves the box
+    // by more than a small fraction of its length.
+    constexpr float max_fractional_drift = 0.1;
+    const bool is2D = m_box.is2D();
+    bool drifted = false;
+    for (unsigned int slot = 0; slot < m_n_points; ++slot)
+    {
+        vec3<float> point(m_points[m_leaf_tags[slot]]);
+        if (is2D)
+        {
+            point.z = 0;
+        }
+        const vec3<float> unwrapped = m_leaf_points[slot] + m_box.wrap(point - m_leaf_points[slot]);
+
+        // Use the exact image of the point to avoid accumulating roundoff.
+        vec3<int> image;
+        m_box.getImage(unwrapped, image);
+        if (image != vec3<int>(0, 0, 0))
+        {
+            point += vec3<float>(m_box.getLatticeVector(0)) * float(image.x);
+            point += vec3<float>(m_box.getLatticeVector(1)) * float(image.y);
+            if (!is2D)
+            {
+                point += vec3<float>(m_box.getLatticeVector(2)) * float(image.z);
+            }
+        }
+        m_leaf_points[slot] = point;
+
+        const vec3<float> frac = m_box.makeFractional(point);
+        if (frac.x < -max_fractional_drift || frac.x > 1 + max_fractional_drift
+            || frac.y < -max_fractional_drift || frac.y > 1 + max_fractional_drift
+            || (!is2D && (frac.z < -max_fractional_drift || frac.z > 1 + max_fractional_drift)))
+        {
+            drifted = true;
+        }
+    }
+    if (drifted)
+    {
+        buildTree(m_points, m_n_points);
+        return true;
+    }
+
+    // The tree build permutes m_aabbs, but refit looks up the AABBs by
+    // particle index, so they are regenerated in order.
+    makeAABBs();
+    m_aabb_tree.refit(m_aabbs.data());
+
+    if (m_aabb_tree.getSurfaceArea() > max_area_ratio * m_build_surface_area)
+    {
+        buildTree(m_points, m_n_points);
+        return true;
+    }
+    return false;
+}
+
+std::vector<vec3<float>> AABBQuery::getImageVectors(float r_max, bool check_r_max) const
 {
-    box::Box box = m_neighbor_query->getBox();
-    vec3<float> nearest_plane_distance = box.getNearestPlaneDistance();
-    vec3<bool> periodic = box.getPeriodic();
-    if (_check_r_max)
+    vec3<float> nearest_plane_distance = m_box.getNearestPlaneDistance();
+    vec3<bool> periodic = m_box.getPeriodic();
+    if (check_r_max)
     {
         if ((periodic.x && nearest_plane_distance.x <= r_max * 2.0)
             || (periodic.y && nearest_plane_distance.y <= r_max * 2.0)
-            || (!box.is2D() && periodic.z && nearest_plane_distance.z <= r_max * 2.0))
+            || (!m_box.is2D() && periodic.z && nearest_plane_distance.z <= r_max * 2.0))
         {
             throw std::runtime_error("The AABBQuery r_max is too large for this box.");
         }
@@ -80,53 +190,217 @@ void AABBIterator::updateImageVectors(float r_max, bool _check_r_max)
     // Each dimension increases by one power of 3
     unsigned int n_dim_periodic = static_cast<unsigned int>(periodic.x)
         + static_cast<unsigned int>(periodic.y)
-        + static_cast<unsigned int>(!box.is2D()) * static_cast<unsigned int>(periodic.z);
-    m_n_images = 1;
+        + static_cast<unsigned int>(!m_box.is2D()) * static_cast<unsigned int>(periodic.z);
+    unsigned int n_images_total = 1;
     for (unsigned int dim = 0; dim < n_dim_periodic; ++dim)
     {
-        m_n_images *= 3;
+        n_images_total *= 3;
     }
 
-    // Reallocate memory if necessary
-    if (m_n_images > m_image_list.size())
-    {
-        m_image_list.resize(m_n_images);
-    }
+    std::vector<vec3<float>> image_list(n_images_total);
 
-    vec3<float> latt_a = vec3<float>(box.getLatticeVector(0));
-    vec3<float> latt_b = vec3<float>(box.getLatticeVector(1));
+    vec3<float> latt_a = vec3<float>(m_box.getLatticeVector(0));
+    vec3<float> latt_b = vec3<float>(m_box.getLatticeVector(1));
     vec3<float> latt_c = vec3<float>(0.0, 0.0, 0.0);
-    if (!box.is2D())
+    if (!m_box.is2D())
     {
-        latt_c = vec3<float>(box.getLatticeVector(2));
+        latt_c = vec3<float>(m_box.getLatticeVector(2));
     }
 
     // There is always at least 1 image, which we put as our first thing to look at
-    m_image_list[0] = vec3<float>(0.0, 0.0, 0.0);
+    image_list[0] = vec3<float>(0.0, 0.0, 0.0);
 
     // Iterate over all other combinations of images
     unsigned int n_images = 1;
-    for (int i = -1; i <= 1 && n_images < m_n_images; ++i)
+    for (int i = -1; i <= 1 && n_images < n_images_total; ++i)
     {
-        for (int j = -1; j <= 1 && n_images < m_n_images; ++j)
+        for (int j = -1; j <= 1 && n_images < n_images_total; ++j)
         {
-            for (int k = -1; k <= 1 && n_images < m_n_images; ++k)
+            for (int k = -1; k <= 1 && n_images < n_images_total; ++k)
             {
                 if (!(i == 0 && j == 0 && k == 0))
                 {
                     // Skip any periodic images if we don't have periodicity
                     if ((i != 0 && !periodic.x) || (j != 0 && !periodic.y)
-                        || (k != 0 && (box.is2D() || !periodic.z)))
+                        || (k != 0 && (m_box.is2D() || !periodic.z)))
                     {
                         continue;
                     }
 
-                    m_image_list[n_images] = float(i) * latt_a + float(j) * latt_b + float(k) * latt_c;
+                    image_list[n_images] = float(i) * latt_a + float(j) * latt_b + float(k) * latt_c;
                     ++n_images;
                 }
             }
         }
     }
+    return image_list;
+}
+
+namespace {
+
+//! Squared distance from a point to the closest point of an AABB (zero inside)
+inline float distanceSquared(const AABB& aabb, const vec3<float>& point)
+{
+    const vec3<float> lower = aabb.getLower();
+    const vec3<float> upper = aabb.getUpper();
+    const vec3<float> delta(std::max(std::max(lower.x - point.x, point.x - upper.x), 0.0F),
+                            std::max(std::max(lower.y - point.y, point.y - upper.y), 0.0F),
+                            std::max(std::max(lower.z - point.z, point.z - upper.z), 0.0F));
+    return dot(delta, delta);
+}
+
+//! Order candidate neighbors by distance, breaking ties by point index
+inline bool closerBond(const NeighborBond& a, const NeighborBond& b)
+{
+    return a.distance < b.distance || (a.distance == b.distance && a.point_idx < b.point_idx);
+}
+
+//! Order queued nodes so that the heap top is the closest node
+inline bool fartherNode(const AABBQuery::NodeDistance& a, const AABBQuery::NodeDistance& b)
+{
+    return a.distance_sq > b.distance_sq;
+}
+
+} // end anonymous namespace
+
+bool AABBQuery::findNearestNeighbors(const vec3<float>& query_point, unsigned int query_point_idx,
+                                     unsigned int num_neighbors, float r_max, float r_min, bool exclude_ii,
+                                     const std::vector<vec3<float>>& image_list,
+                                     std::vector<NodeDistance>& node_queue,
+                                     std::vector<NeighborBond>& neighbors) const
+{
+    node_queue.clear();
+    neighbors.clear();
+    if (num_neighbors == 0 || m_aabb_tree.getNumNodes() == 0)
+    {
+        return true;
+    }
+
+    // Within half the nearest plane distance every point has at most one
+    // periodic image, so the first image found is the minimum image.
+    const vec3<float> plane_distance = m_box.getNearestPlaneDistance();
+    float min_plane_distance = std::min(plane_distance.x, plane_distance.y);
+    if (!m_box.is2D())
+    {
+        min_plane_distance = std::min(min_plane_distance, plane_distance.z);
+    }
+    const float safe_r = min_plane_distance / float(2.0);
+    const float search_r = std::min(r_max, safe_r);
+    const float search_r_sq = search_r * search_r;
+    const float r_min_sq = r_min * r_min;
+
+    vec3<float> pos_i(query_point);
+    if (m_box.is2D())
+    {
+        pos_i.z = 0;
+    }
+
+    // The search bound shrinks to the k-th best candidate once the heap is full.
+    float bound_sq = search_r_sq;
+
+    // The root is the first node in the tree. Images whose root AABB is out
+    // of range are pruned before the traversal starts.
+    for (unsigned int image = 0; image < image_list.size(); ++image)
+    {
+        const float d_sq = distanceSquared(m_aabb_tree.getNodeAABB(0), pos_i + image_list[image]);
+        if (d_sq <= bound_sq)
+        {
+            node_queue.push_back({d_sq, 0, image});
+        }
+    }
+    std::make_heap(node_queue.begin(), node_queue.end(), fartherNode);
+
+    while (!node_queue.empty())
+    {
+        std::pop_heap(node_queue.begin(), node_queue.end(), fartherNode);
+        const NodeDistance current = node_queue.back();
+        node_queue.pop_back();
+
+        // Every remaining node is at least this far away.
+        if (current.distance_sq > bound_sq)
+        {
+            break;
+        }
+
+        // Descend directly into the nearer child and defer the farther one,
+        // which avoids a round trip through the queue at every level.
+        const vec3<float> pos_i_image = pos_i + image_list[current.image];
+        unsigned int node_idx = current.node;
+        while (node_idx != INVALID_NODE && !m_aabb_tree.isNodeLeaf(node_idx))
+        {
+            const AABBNode& node = m_aabb_tree.getNode(node_idx);
+            float near_sq = distanceSquared(m_aabb_tree.getNodeAABB(node.left), pos_i_image);
+            float far_sq = distanceSquared(m_aabb_tree.getNodeAABB(node.right), pos_i_image);
+            unsigned int near_node = node.left;
+            unsigned int far_node = node.right;
+            if (far_sq < near_sq)
+            {
+                std::swap(near_sq, far_sq);
+                std::swap(near_node, far_node);
+            }
+            if (far_sq <= bound_sq)
+            {
+                node_queue.push_back({far_sq, far_node, current.image});
+                std::push_heap(node_queue.begin(), node_queue.end(), fartherNode);
+            }
+            node_idx = (near_sq <= bound_sq) ? near_node : INVALID_NODE;
+        }
+        if (node_idx == INVALID_NODE)
+        {
+            continue;
+        }
+
+        const AABBNode& node = m_aabb_tree.getNode(node_idx);
+        const vec3<float>* leaf_points = m_leaf_points.data() + m_node_offsets[node_idx];
+        for (unsigned int p = 0; p < node.num_particles; ++p)
+        {
+            const unsigned int j = node.particle_tags[p];
+            if (exclude_ii && query_point_idx == j)
+            {
+                continue;
+            }
+
+            const vec3<float> r_ij = leaf_points[p] - pos_i_image;
+            const float r_sq = dot(r_ij, r_ij);
+            if (r_sq > bound_sq || r_sq >= search_r_sq || r_sq < r_min_sq)
+            {
+                continue;
+            }
+
+            const NeighborBond candidate(query_point_idx, j, std::sqrt(r_sq));
+            if (neighbors.size() == num_neighbors)
+            {
+                if (!closerBond(candidate, neighbors.front()))
+                {
+                    continue;
+                }
+                std::pop_heap(neighbors.begin(), neighbors.end(), closerBond);
+                neighbors.back() = candidate;
+            }
+            else
+            {
+                neighbors.push_back(candidate);
+            }
+            std::push_heap(neighbors.begin(), neighbors.end(), closerBond);
+
+            if (neighbors.size() == num_neighbors)
+            {
+                bound_sq = std::min(search_r_sq, neighbors.front().distance * neighbors.front().distance);
+            }
+        }
+    }
+
+    std::sort_heap(neighbors.begin(), neighbors.end(), closerBond);
+
+    // Neighbors closer than the safe distance are exact. Otherwise the
+    // caller must extend the search beyond it.
+    return neighbors.size() == num_neighbors || r_max <= safe_r;
+}
+
+void AABBIterator::updateImageVectors(float r_max, bool _check_r_max)
+{
+    m_image_list = m_aabb_query->getImageVectors(r_max, _check_r_max);
+    m_n_images = m_image_list.size();
 }
 
 NeighborBond AABBQueryBallIterator::next()
@@ -160,22 +434,17 @@ NeighborBond AABBQueryBallIterator::next()
                         // Neighbor j
                         const unsigned int j
                             = m_aabb_query->m_aabb_tree.getNodeParticleTag(cur_node_idx, cur_ref_p);
+                        const unsigned int slot = m_aabb_query->m_node_offsets[cur_node_idx] + cur_ref_p;
+                        const vec3<float>& pos_j = m_aabb_query->m_leaf_points[slot];
                         // Increment before possible return.
                         cur_ref_p++;
 
-                        // Skip ii matches immediately if requested.
-                        if (m_exclude_ii && m_query_point_idx == j)
+                        // Skip ii matches (or j <= i for half lists) immediately if requested.
+                        if (excludeIndex(j))
                         {
                             continue;
                         }
 
-                        // Read in the position of j
-                        vec3<float> pos_j((*m_neighbor_query)[j]);
-                        if (m_neighbor_query->getBox().is2D())
-                        {
-                            pos_j.z = 0;
-                        }
-
                         // Compute distance
                         const vec3<float> r_ij = pos_j - pos_i_image;
                         const float r_sq = dot(r_ij, r_ij);
@@ -221,8 +490,17 @@ NeighborBond AABBQueryIterator::next()
     // search for new neighbors the first time next is called.
     if (m_current_neighbors.empty())
     {
+        // Most searches are answered exactly by a best-first traversal of
+        // the tree. The expanding ball queries below are only needed when the
+        // neighbors may lie beyond half the nearest plane distance.
+        std::vector<AABBQuery::NodeDistance> node_queue;
+        const bool found = static_cast<const AABBQuery*>(m_neighbor_query)
+                               ->findNearestNeighbors(m_query_point, m_query_point_idx, m_num_neighbors,
+                                                      m_r_max, m_r_min, m_exclude_ii, m_image_list,
+                                                      node_queue, m_current_neighbors);
+
         // Continually perform ball queries until the termination conditions are met.
-        while (true)
+        while (!found)
         {
             // Perform a ball query to get neighbors. To ensure that we allow
             // ball queries to exceed their normal boundaries, we pass false as
@@ -271,7 +549,8 @@ NeighborBond AABBQueryIterator::next()
             }
 
             // Break if there are enough neighbors, or if we are querying beyond the limits of
-            // the periodic box.
+            // the periodic box. The last query must have covered r_max before stopping there.
+            const bool searched_r_max = m_r_cur >= m_r_max;
             m_r_cur *= m_scale;
 
             if (m_current_neighbors.size() >= m_num_neighbors)
@@ -280,7 +559,7 @@ NeighborBond AABBQueryIterator::next()
                 break;
             }
 
-            if ((m_r_cur >= m_r_max) || (m_r_cur >= max_plane_distance)
+            if (searched_r_max || (m_r_cur >= max_plane_distance)
                 || ((m_all_distances.size() - m_query_points_below_r_min.size()) >= m_num_neighbors))
             {
                 // Once this condition is reached, either we found enough
@@ -32,6 +32,14 @@ namespace freud { namespace locality {
 class AABBQuery : public NeighborQuery
 {
 public:
+    //! A tree node to be searched for a given periodic image of a query point.
+    struct NodeDistance
+    {
+        float distance_sq;  //!< Squared distance from the query point image to the node AABB
+        unsigned int node;  //!< Index of the node in the tree
+        unsigned int image; //!< Index of the image vector applied to the query point
+    };
+
     //! Constructs the compute
     AABBQuery();
 
@@ -49,6 +57,66 @@ public:
     std::shared_ptr<NeighborQueryPerPointIterator>
     querySingle(const vec3<float> query_point, unsigned int query_point_idx, QueryArgs args) const override;
 
+    //! Implementation of the visitor query for AABBQuery (see NeighborQuery.h for documentation).
+    /*! Ball queries traverse the tree directly for each query point, so no
+     *  per-point iterators are allocated.
+     */
+    template<typename Visitor>
+    void forEachNeighbor(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                         const Visitor& visit, bool parallel = true) const
+    {
+        validatePeriodic();
+        visitNeighbors(query_points, n_query_points, qargs, visit, parallel);
+    }
+
+    //! Update the points for a new frame, refitting the existing tree when possible.
+    /*! The tree topology is reused and all node bounds are refit bottom-up
+     *  to the new points. The tree is rebuilt from scratch if the number of
+     *  points changes, or if the summed surface area of the refit tree
+     *  exceeds max_area_ratio times the surface area of the last built tree.
+     *  Points that cross a periodic boundary are kept in the tree at the
+     *  periodic image closest to their previous position, so the tree is
+     *  also rebuilt once any point has drifted too far outside the box.
+     *  As in the constructor, the points are not copied and must outlive the
+     *  AABBQuery.
+     *  \param points The new point coordinates.
+     *  \param n_points The number of points.
+     *  \param max_area_ratio The surface area ratio above which the tree is rebuilt.
+     *  \returns True if the tree was rebuilt, false if it was refit.
+     */
+    bool updatePoints(const vec3<float>* points, unsigned int n_points, float max_area_ratio = 1.5);
+
+    //! Find the nearest neighbors of a point with a best-first traversal of the tree.
+    /*! Nodes are visited in order of increasing distance from the query
+     *  point across all periodic images, while a bounded max-heap holds the
+     *  best candidates found so far. Nodes farther than the current k-th
+     *  candidate are pruned, so each candidate point is evaluated once.
+     *  The search is limited to half the nearest plane distance of the box,
+     *  within which every point has at most one periodic image.
+     *  \param query_point The point to find neighbors for.
+     *  \param query_point_idx The index of the query point.
+     *  \param num_neighbors The number of neighbors to find.
+     *  \param r_max The maximum distance of a neighbor.
+     *  \param r_min The minimum distance of a neighbor.
+     *  \param exclude_ii Whether to exclude the point with the same index.
+     *  \param image_list The image vectors of the box (see getImageVectors).
+     *  \param node_queue Storage for the queue of nodes, reused between calls.
+     *  \param neighbors Output neighbors sorted by distance.
+     *  \returns False if the result may be incomplete because the neighbors
+     *            extend beyond the safe search distance, true otherwise.
+     */
+    bool findNearestNeighbors(const vec3<float>& query_point, unsigned int query_point_idx,
+                              unsigned int num_neighbors, float r_max, float r_min, bool exclude_ii,
+                              const std::vector<vec3<float>>& image_list,
+                              std::vector<NodeDistance>& node_queue,
+                              std::vector<NeighborBond>& neighbors) const;
+
+    //! Compute the periodic image vectors that must be checked for a given cutoff.
+    /*! \param r_max The query distance.
+     *  \param check_r_max If true, raise an error if r_max is too large for the box.
+     */
+    std::vector<vec3<float>> getImageVectors(float r_max, bool check_r_max = true) const;
+
     AABBTree m_aabb_tree; //!< AABB tree of points
 
 protected:
@@ -101,6 +169,22 @@ protected:
     }
 
 private:
+    // RawPoints delegates to an AABBQuery but does not require periodicity.
+    friend class RawPoints;
+    // Ball iterators compute distances from the positions stored in the tree.
+    friend class AABBQueryBallIterator;
+
+    //! Validate the query arguments and visit all neighbors.
+    template<typename Visitor>
+    void visitNeighbors(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                        const Visitor& visit, bool parallel) const;
+
+    //! Visit all neighbors of a single point within a ball.
+    template<typename Visitor>
+    void visitBall(const vec3<float>& query_point, unsigned int query_point_idx, float r_max, float r_min,
+                   bool exclude_ii, bool half_list, const std::vector<vec3<float>>& image_list,
+                   const Visitor& visit) const;
+
     //! Driver for tree configuration
     void setupTree(unsigned int N);
 
@@ -110,7 +194,27 @@ private:
     //! Driver to build AABB trees
     void buildTree(const vec3<float>* points, unsigned int N);
 
-    std::vector<AABB> m_aabbs; //!< Flat array of AABBs of all types
+    //! Construct a point AABB for each tree point
+    void makeAABBs();
+
+    //! Store the tree points in the order of the leaves of the tree
+    void updateLeafOrder(const std::vector<vec3<float>>& tree_points);
+
+    //! Get the order in which to process query points
+    /*! Self-queries are processed in the order of the leaves, so that
+     *  consecutive query points traverse the same parts of the tree.
+     *  Returns nullptr if the query points are processed in their own order.
+     */
+    const unsigned int* getQueryOrder(const vec3<float>* query_points, unsigned int n_query_points) const
+    {
+        return (query_points == m_points && n_query_points == m_n_points) ? m_leaf_tags.data() : nullptr;
+    }
+
+    std::vector<AABB> m_aabbs;                //!< Flat array of AABBs of all types
+    std::vector<vec3<float>> m_leaf_points;   //!< Tree positions in leaf order, possibly periodic images
+    std::vector<unsigned int> m_leaf_tags;    //!< Point index of each entry of m_leaf_points
+    std::vector<unsigned int> m_node_offsets; //!< Index in m_leaf_points of the first point of each node
+    float m_build_surface_area {0};           //!< Summed node surface area of the last built tree
 };
 
 //! Parent class of AABB iterators that knows how to traverse general AABB tree structures.
@@ -119,9 +223,10 @@ class AABBIterator : public NeighborQueryPerPointIterator
 public:
     //! Constructor
     AABBIterator(const AABBQuery* neighbor_query, const vec3<float>& query_point,
-                 unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii)
+                 unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii,
+                 bool half_list = false)
         : NeighborQueryPerPointIterator(neighbor_query, query_point, query_point_idx, r_max, r_min,
-                                        exclude_ii),
+                                        exclude_ii, half_list),
           m_aabb_query(neighbor_query)
     {}
 
@@ -180,9 +285,9 @@ public:
     //! Constructor
     AABBQueryBallIterator(const AABBQuery* neighbor_query, const vec3<float>& query_point,
                           unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii,
-                          bool _check_r_max = true)
-        : AABBIterator(neighbor_query, query_point, query_point_idx, r_max, r_min, exclude_ii), cur_image(0),
-          cur_node_idx(0), cur_ref_p(0)
+                          bool _check_r_max = true, bool half_list = false)
+        : AABBIterator(neighbor_query, query_point, query_point_idx, r_max, r_min, exclude_ii, half_list),
+          cur_image(0), cur_node_idx(0), cur_ref_p(0)
     {
         updateImageVectors(m_r_max, _check_r_max);
     }
@@ -199,6 +304,124 @@ private:
     unsigned int
         cur_ref_p; //!< The current index into the reference particles in the current node of the tree.
 };
+
+template<typename Visitor>
+void AABBQuery::visitNeighbors(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                               const Visitor& visit, bool parallel) const
+{
+    this->validateQueryArgs(qargs);
+    validateHalfList(query_points, n_query_points, qargs);
+    if (qargs.mode == QueryType::ball)
+    {
+        // The image vectors only depend on the box and the cutoff, so they
+        // are computed once and shared by all query points.
+        const std::vector<vec3<float>> image_list = getImageVectors(qargs.r_max);
+        const unsigned int* order = getQueryOrder(query_points, n_query_points);
+        util::forLoopWrapper(
+            0, n_query_points,
+            [&](size_t begin, size_t end) {
+                for (size_t idx = begin; idx != end; ++idx)
+                {
+                    const size_t i = (order != nullptr) ? order[idx] : idx;
+                    visitBall(query_points[i], i, qargs.r_max, qargs.r_min, qargs.exclude_ii, qargs.half_list,
+                              image_list, visit);
+                }
+            },
+            parallel);
+    }
+    else
+    {
+        const std::vector<vec3<float>> image_list = getImageVectors(0);
+        const unsigned int* order = getQueryOrder(query_points, n_query_points);
+        util::forLoopWrapper(
+            0, n_query_points,
+            [&](size_t begin, size_t end) {
+                std::vector<NodeDistance> node_queue;
+                std::vector<NeighborBond> neighbors;
+                for (size_t idx = begin; idx != end; ++idx)
+                {
+                    const size_t i = (order != nullptr) ? order[idx] : idx;
+                    if (findNearestNeighbors(query_points[i], i, qargs.num_neighbors, qargs.r_max,
+                                             qargs.r_min, qargs.exclude_ii, image_list, node_queue,
+                                             neighbors))
+                    {
+                        for (const NeighborBond& nb : neighbors)
+                        {
+                            visit(nb);
+                        }
+                        continue;
+                    }
+
+                    // Neighbors beyond the safe search distance are found
+                    // by the expanding ball queries of the iterator.
+                    std::shared_ptr<NeighborQueryPerPointIterator> it
+                        = querySingle(query_points[i], i, qargs);
+                    NeighborBond nb = it->next();
+                    while (!it->end())
+                    {
+                        visit(nb);
+                        nb = it->next();
+                    }
+                }
+            },
+            parallel);
+    }
+}
+
+template<typename Visitor>
+void AABBQuery::visitBall(const vec3<float>& query_point, unsigned int query_point_idx, float r_max,
+                          float r_min, bool exclude_ii, bool half_list,
+                          const std::vector<vec3<float>>& image_list, const Visitor& visit) const
+{
+    const float r_max_sq = r_max * r_max;
+    const float r_min_sq = r_min * r_min;
+    const bool is2D = m_box.is2D();
+
+    vec3<float> pos_i(query_point);
+    if (is2D)
+    {
+        pos_i.z = 0;
+    }
+
+    const unsigned int num_nodes = m_aabb_tree.getNumNodes();
+    for (const vec3<float>& image : image_list)
+    {
+        const vec3<float> pos_i_image = pos_i + image;
+        const AABBSphere asphere(pos_i_image, r_max);
+
+        // Stackless traversal of the tree
+        for (unsigned int node_idx = 0; node_idx < num_nodes; ++node_idx)
+        {
+            const AABBNode& node = m_aabb_tree.getNode(node_idx);
+            if (!overlap(node.aabb, asphere))
+            {
+                node_idx += node.skip;
+                continue;
+            }
+            if (node.left != INVALID_NODE)
+            {
+                continue;
+            }
+            const vec3<float>* leaf_points = m_leaf_points.data() + m_node_offsets[node_idx];
+            for (unsigned int p = 0; p < node.num_particles; ++p)
+            {
+                const unsigned int j = node.particle_tags[p];
+                if (excludeNeighborIndex(query_point_idx, j, exclude_ii, half_list))
+                {
+                    continue;
+                }
+
+                const vec3<float> r_ij = leaf_points[p] - pos_i_image;
+                const float r_sq = dot(r_ij, r_ij);
+                if (r_sq < r_max_sq && r_sq >= r_min_sq)
+                {
+                    visit(NeighborBond(query_point_idx, j, std::sqrt(r_sq)));
+                }
+            }
+        }
+    }
+}
+
 }; }; // end namespace freud::locality
 
 #endif // AABBQUERY_H
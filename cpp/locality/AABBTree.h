@@ -67,6 +67,8 @@ struct CACHE_ALIGN AABBNode
    tree topology is left unchanged. Runs in O(log N) time. AABBs are not saved for all particles, so an update
    will only increase the volume of nodes. The tree should be rebuilt periodically instead of continually
    updated.
+    - Refit : Recompute the AABBs of all nodes bottom-up from a new set of particle AABBs, keeping the tree
+   topology. Runs in O(N) time. The summed node surface area measures how much a refit tree has degraded.
     - buildTree : build an efficiently arranged tree given a complete set of AABBs, one for each particle.
 
     **Implementation details**
@@ -164,6 +166,12 @@ public:
     //! Update the AABB of a particle
     inline void update(unsigned int idx, const AABB& aabb);
 
+    //! Refit all node AABBs to a new set of particle AABBs
+    inline void refit(const AABB* aabbs);
+
+    //! Get the summed surface area of all node AABBs
+    inline float getSurfaceArea() const;
+
     //! Get the height of a given particle's leaf node
     inline unsigned int height(unsigned int idx);
 
@@ -349,6 +357,50 @@ inline void AABBTree::update(unsigned int idx, const AABB& aabb)
     }
 }
 
+/*! \param aabbs List of AABBs for each particle, indexed by particle
+
+    Refit the tree so that every node tightly bounds the AABBs of the particles below it. Like update(),
+   refit() does not change the tree topology, but it also shrinks nodes. Nodes are allocated in pre-order by
+   buildNode(), so all children of a node have larger indices than the node itself and a single pass over the
+   nodes in reverse order refits every child before its parent.
+*/
+inline void AABBTree::refit(const AABB* aabbs)
+{
+    for (unsigned int node_idx = m_num_nodes; node_idx-- > 0;)
+    {
+        AABBNode& node = m_nodes[node_idx];
+        if (node.left == INVALID_NODE)
+        {
+            AABB leaf_aabb = aabbs[node.particles[0]];
+            for (unsigned int i = 1; i < node.num_particles; i++)
+            {
+                leaf_aabb = merge(leaf_aabb, aabbs[node.particles[i]]);
+            }
+            node.aabb = leaf_aabb;
+        }
+        else
+        {
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+        }
+    }
+}
+
+/*! \returns The sum of the surface areas of all nodes
+
+    The summed surface area is proportional to the expected number of nodes visited by a random query, so it
+   is a measure of the quality of the tree. It grows as a refit tree drifts away from a freshly built one.
+*/
+inline float AABBTree::getSurfaceArea() const
+{
+    float area = 0;
+    for (unsigned int node_idx = 0; node_idx < m_num_nodes; node_idx++)
+    {
+        const vec3<float> extent = m_nodes[node_idx].aabb.getUpper() - m_nodes[node_idx].aabb.getLower();
+        area += extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+    }
+    return float(2.0) * area;
+}
+
 /*! \param idx Particle to get height for
     \returns Height of the node
 */
@@ -96,14 +96,16 @@ public:
            appropriately with given qargs.
         \param qargs Query arguments
         \param cf An object with operator(NeighborBond) as input.
+        \param allow_half_list If true, half neighbor lists are accepted.
     */
     template<typename Func>
     void accumulateGeneral(const locality::NeighborQuery* neighbor_query, const vec3<float>* query_points,
                            unsigned int n_query_points, const locality::NeighborList* nlist,
-                           locality::QueryArgs qargs, Func cf)
+                           locality::QueryArgs qargs, Func cf, bool allow_half_list = false)
     {
         m_box = neighbor_query->getBox();
-        locality::loopOverNeighbors(neighbor_query, query_points, n_query_points, qargs, nlist, cf);
+        locality::loopOverNeighbors(neighbor_query, query_points, n_query_points, qargs, nlist, cf, true,
+                                    allow_half_list);
         m_frame_counter++;
         m_n_points = neighbor_query->getNPoints();
         m_n_query_points = n_query_points;
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <tbb/task_arena.h>
 
 #include "LinkCell.h"
 
@@ -18,11 +19,11 @@ namespace freud { namespace locality {
  ********************/
 void IteratorLinkCell::copy(const IteratorLinkCell& rhs)
 {
-    m_cell_list = rhs.m_cell_list;
-    m_Np = rhs.m_Np;
-    m_Nc = rhs.m_Nc;
+    m_cell_point_ids = rhs.m_cell_point_ids;
+    m_cell_begin = rhs.m_cell_begin;
+    m_cell_end = rhs.m_cell_end;
+    m_next = rhs.m_next;
     m_cur_idx = rhs.m_cur_idx;
-    m_cell = rhs.m_cell;
 }
 
 bool IteratorLinkCell::atEnd() const
@@ -32,15 +33,22 @@ bool IteratorLinkCell::atEnd() const
 
 unsigned int IteratorLinkCell::next()
 {
-    m_cur_idx = m_cell_list[m_cur_idx];
+    if (m_next < m_cell_end)
+    {
+        m_cur_idx = m_cell_point_ids.get()[m_next];
+        ++m_next;
+    }
+    else
+    {
+        m_cur_idx = LINK_CELL_TERMINATOR;
+    }
     return m_cur_idx;
 }
 
 unsigned int IteratorLinkCell::begin()
 {
-    m_cur_idx = m_Np + m_cell;
-    m_cur_idx = m_cell_list[m_cur_idx];
-    return m_cur_idx;
+    m_next = m_cell_begin;
+    return next();
 }
 
 /*********************
@@ -248,6 +256,7 @@ LinkCell::LinkCell(const box::Box& box, const vec3<float>* points, unsigned int
         throw std::runtime_error("At least one cell must be present.");
     }
 
+    computeStencil();
     computeCellList(points, n_points);
 }
 
@@ -307,24 +316,73 @@ vec3<unsigned int> LinkCell::computeDimensions(const box::Box& box, float cell_w
 
 void LinkCell::computeCellList(const vec3<float>* points, unsigned int n_points)
 {
-    // determine the number of cells and allocate memory
-    unsigned int Nc = getNumCells();
-    m_cell_list.prepare(n_points + Nc);
+    const unsigned int Nc = getNumCells();
     m_n_points = n_points;
 
-    // initialize memory
-    for (unsigned int cell = 0; cell < Nc; cell++)
-    {
-        m_cell_list[n_points + cell] = LINK_CELL_TERMINATOR;
-    }
+    // Compute the cell of every point.
+    std::vector<unsigned int> point_cells(n_points);
+    util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            point_cells[i] = getCell(points[i]);
+        }
+    });
+
+    // Sort the points by cell with a counting sort. The points are split into
+    // contiguous blocks that are counted and scattered in parallel. Each
+    // (cell, block) pair gets its own range of the output, laid out in cell
+    // major order, so points within a cell stay sorted by index.
+    const unsigned int block_size = 4096;
+    const unsigned int n_blocks = std::max(
+        std::min(static_cast<unsigned int>(tbb::this_task_arena::max_concurrency()),
+                 (n_points + block_size - 1) / block_size),
+        1U);
+    const unsigned int points_per_block = (n_points + n_blocks - 1) / n_blocks;
+
+    std::vector<unsigned int> block_offsets(static_cast<size_t>(Nc) * n_blocks, 0);
+    util::forLoopWrapper(0, n_blocks, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block)
+        {
+            const unsigned int first = block * points_per_block;
+            const unsigned int last = std::min(first + points_per_block, n_points);
+            for (unsigned int i = first; i < last; ++i)
+            {
+                ++block_offsets[point_cells[i] * n_blocks + block];
+            }
+        }
+    });
 
-    // Generate the cell list.
-    for (unsigned int i = n_points - 1; i != static_cast<unsigned int>(-1); --i)
+    m_cell_offsets.prepare(Nc + 1);
+    unsigned int total = 0;
+    for (unsigned int cell = 0; cell < Nc; ++cell)
     {
-        unsigned int cell = getCell(points[i]);
-        m_cell_list[i] = m_cell_list[n_points + cell];
-        m_cell_list[n_points + cell] = i;
+        m_cell_offsets[cell] = total;
+        for (unsigned int block = 0; block < n_blocks; ++block)
+        {
+            const unsigned int count = block_offsets[cell * n_blocks + block];
+            block_offsets[cell * n_blocks + block] = total;
+            total += count;
+        }
     }
+    m_cell_offsets[Nc] = total;
+
+    m_cell_point_ids.prepare(n_points);
+    m_cell_points.prepare(n_points);
+    unsigned int* cell_point_ids = m_cell_point_ids.get();
+    vec3<float>* cell_points = m_cell_points.get();
+    util::forLoopWrapper(0, n_blocks, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block)
+        {
+            const unsigned int first = block * points_per_block;
+            const unsigned int last = std::min(first + points_per_block, n_points);
+            for (unsigned int i = first; i < last; ++i)
+            {
+                const unsigned int slot = block_offsets[point_cells[i] * n_blocks + block]++;
+                cell_point_ids[slot] = i;
+                cell_points[slot] = points[i];
+            }
+        }
+    });
 }
 
 vec3<unsigned int> LinkCell::indexToCoord(unsigned int x) const
@@ -360,114 +418,127 @@ vec3<unsigned int> LinkCell::getCellCoord(const vec3<float>& p) const
     return c;
 }
 
-const std::vector<unsigned int>& LinkCell::getCellNeighbors(unsigned int cell) const
-{
-    // check if the list of neighbors has been already computed
-    // return the list if it has
-    // otherwise, compute it and return
-    CellNeighbors::const_accessor a;
-    if (m_cell_neighbors.find(a, cell))
-    {
-        return a->second;
-    }
-    return computeCellNeighbors(cell);
-}
+namespace {
 
-const std::vector<unsigned int>& LinkCell::computeCellNeighbors(unsigned int cur_cell) const
+//! Call a function for each offset of a shell of cells, in IteratorCellShell order.
+/*! Only offsets whose components lie within \a half of zero are visited.
+ *  Offsets beyond half the cell list wrap onto a cell that is reached by a
+ *  smaller offset, so skipping them loses no cells, and the work per shell
+ *  is proportional to the number of offsets visited.
+ */
+template<typename Func>
+void forEachShellOffset(int range, const vec3<int>& half, bool is2D, const Func& func)
 {
-    std::vector<unsigned int> neighbor_cells;
-    vec3<unsigned int> l_idx = indexToCoord(cur_cell);
-    const int i = static_cast<int>(l_idx.x);
-    const int j = static_cast<int>(l_idx.y);
-    const int k = static_cast<int>(l_idx.z);
-
-    // loop over the neighbor cells
-    int starti;
-    int startj;
-    int startk;
-    int endi;
-    int endj;
-    int endk;
-    if (m_celldim.x < 3)
-    {
-        starti = i;
-    }
-    else
-    {
-        starti = i - 1;
-    }
-    if (m_celldim.y < 3)
-    {
-        startj = j;
-    }
-    else
-    {
-        startj = j - 1;
-    }
-    if (m_celldim.z < 3)
-    {
-        startk = k;
-    }
-    else
+    if (range == 0)
     {
-        startk = k - 1;
+        func(vec3<int>(0, 0, 0));
+        return;
     }
 
-    if (m_celldim.x < 2)
-    {
-        endi = i;
-    }
-    else
-    {
-        endi = i + 1;
-    }
-    if (m_celldim.y < 2)
+    // Offsets run over [-range, range] in each dimension, clamped to [-half, half].
+    const int x_min = std::max(-range, -half.x);
+    const int x_max = std::min(range, half.x);
+    const int y_min = std::max(-range, -half.y);
+    const int y_max = std::min(range, half.y);
+    const int z_min = is2D ? 0 : std::max(-range + 1, -half.z);
+    const int z_max = is2D ? 0 : std::min(range - 1, half.z);
+
+    for (int z = z_min; z <= z_max; ++z)
     {
-        endj = j;
+        // +y wedge
+        for (int x = x_min; x <= std::min(x_max, range - 1) && range <= half.y; ++x)
+        {
+            func(vec3<int>(x, range, z));
+        }
     }
-    else
+    for (int z = z_min; z <= z_max; ++z)
     {
-        endj = j + 1;
+        // +x wedge
+        for (int y = y_max; y >= std::max(y_min, -range + 1) && range <= half.x; --y)
+        {
+            func(vec3<int>(range, y, z));
+        }
     }
-    if (m_celldim.z < 2)
+    for (int z = z_min; z <= z_max; ++z)
     {
-        endk = k;
+        // -y wedge
+        for (int x = x_max; x >= std::max(x_min, -range + 1) && range <= half.y; --x)
+        {
+            func(vec3<int>(x, -range, z));
+        }
     }
-    else
+    for (int z = z_min; z <= z_max; ++z)
     {
-        endk = k + 1;
+        // -x wedge
+        for (int y = y_min; y <= std::min(y_max, range - 1) && range <= half.x; ++y)
+        {
+            func(vec3<int>(-range, y, z));
+        }
     }
-    if (m_box.is2D())
+    if (!is2D && range <= half.z)
     {
-        startk = endk = k;
-    }
-
-    for (int neighk = startk; neighk <= endk; neighk++)
-    {
-        for (int neighj = startj; neighj <= endj; neighj++)
+        // -z face and +z face
+        for (const int z : {-range, range})
         {
-            for (int neighi = starti; neighi <= endi; neighi++)
+            for (int y = y_min; y <= y_max; ++y)
             {
-                // wrap back into the box
-                unsigned int wrapi = (m_celldim.x + neighi) % m_celldim.x;
-                unsigned int wrapj = (m_celldim.y + neighj) % m_celldim.y;
-                unsigned int wrapk = (m_celldim.z + neighk) % m_celldim.z;
-
-                unsigned int neigh_cell = coordToIndex(wrapi, wrapj, wrapk);
-                // add to the list
-                neighbor_cells.push_back(neigh_cell);
+                for (int x = x_min; x <= x_max; ++x)
+                {
+                    func(vec3<int>(x, y, z));
+                }
             }
         }
     }
+}
+
+} // end anonymous namespace
+
+void LinkCell::computeStencil()
+{
+    const bool is2D = m_box.is2D();
+    const vec3<int> half(m_celldim.x / 2, m_celldim.y / 2, is2D ? 0 : m_celldim.z / 2);
+
+    // Whether two offsets wrap onto the same cell is independent of the
+    // starting cell, so duplicates are identified relative to cell 0. Once
+    // every cell has been covered, no further shells are needed.
+    std::vector<bool> covered(getNumCells(), false);
+    unsigned int num_covered = 0;
+    m_stencil.clear();
+    m_stencil_shells.assign(1, 0);
+    for (int range = 0; num_covered < getNumCells(); ++range)
+    {
+        forEachShellOffset(range, half, is2D, [&](const vec3<int>& offset) {
+            const unsigned int cell = getCellIndex(offset);
+            if (!covered[cell])
+            {
+                covered[cell] = true;
+                ++num_covered;
+                m_stencil.push_back(offset);
+            }
+        });
+        m_stencil_shells.push_back(m_stencil.size());
+    }
+}
+
+std::vector<unsigned int> LinkCell::getCellNeighbors(unsigned int cell) const
+{
+    // The first two shells of the stencil contain every cell within one cell
+    // of this one.
+    const vec3<unsigned int> coord = indexToCoord(cell);
+    const vec3<int> cell_coord(coord.x, coord.y, coord.z);
+    const unsigned int num_neighbors
+        = m_stencil_shells[std::min(static_cast<size_t>(2), m_stencil_shells.size() - 1)];
+
+    std::vector<unsigned int> neighbor_cells;
+    neighbor_cells.reserve(num_neighbors);
+    for (unsigned int i = 0; i < num_neighbors; ++i)
+    {
+        neighbor_cells.push_back(getCellIndex(cell_coord + m_stencil[i]));
+    }
 
     // sort the list
     std::sort(neighbor_cells.begin(), neighbor_cells.end());
-
-    // add the vector of neighbor cells to the hash table
-    CellNeighbors::accessor a;
-    m_cell_neighbors.insert(a, cur_cell);
-    a->second = neighbor_cells;
-    return a->second;
+    return neighbor_cells;
 }
 
 std::shared_ptr<NeighborQueryPerPointIterator>
@@ -477,7 +548,7 @@ LinkCell::querySingle(const vec3<float> query_point, unsigned int query_point_id
     if (args.mode == QueryType::ball)
     {
         return std::make_shared<LinkCellQueryBallIterator>(this, query_point, query_point_idx, args.r_max,
-                                                           args.r_min, args.exclude_ii);
+                                                           args.r_min, args.exclude_ii, args.half_list);
     }
     if (args.mode == QueryType::nearest)
     {
@@ -492,12 +563,11 @@ NeighborBond LinkCellQueryBallIterator::next()
     float r_max_sq = m_r_max * m_r_max;
     float r_min_sq = m_r_min * m_r_min;
 
+    const std::vector<vec3<int>>& stencil = m_linkcell->getStencil();
+    const std::vector<unsigned int>& stencil_shells = m_linkcell->getStencilShells();
     vec3<unsigned int> point_cell(m_linkcell->getCellCoord(m_query_point));
-    const unsigned int point_cell_index = m_linkcell->getCellIndex(
-        vec3<int>(point_cell.x, point_cell.y, point_cell.z) + (*m_neigh_cell_iter));
-    m_searched_cells.insert(point_cell_index);
 
-    // Loop over cell list neighbor shells relative to this point's cell.
+    // Loop over the neighbor cell stencil relative to this point's cell.
     while (true)
     {
         // Iterate over the particles in that cell. Using a local counter
@@ -505,8 +575,8 @@ NeighborBond LinkCellQueryBallIterator::next()
         // track between calls to next.
         for (unsigned int j = m_cell_iter.next(); !m_cell_iter.atEnd(); j = m_cell_iter.next())
         {
-            // Skip ii matches immediately if requested.
-            if (m_exclude_ii && m_query_point_idx == j)
+            // Skip ii matches (or j <= i for half lists) immediately if requested.
+            if (excludeIndex(j))
             {
                 continue;
             }
@@ -520,41 +590,27 @@ NeighborBond LinkCellQueryBallIterator::next()
             }
         }
 
-        bool out_of_range = false;
-
-        while (true)
+        // Determine the next neighbor cell to consider. We're done if we
+        // reach the end of the stencil, or if we reach a new shell and the
+        // closest point of approach to the new shell is greater than our
+        // r_max.
+        ++m_stencil_idx;
+        if (m_stencil_idx >= stencil.size())
         {
-            // Determine the next neighbor cell to consider. We're done if we
-            // reach a new shell and the closest point of approach to the new
-            // shell is greater than our r_max.
-            ++m_neigh_cell_iter;
-
-            if (static_cast<float>(m_neigh_cell_iter.getRange() - m_extra_search_width)
-                    * m_linkcell->getCellWidth()
-                > m_r_max)
-            {
-                out_of_range = true;
-                break;
-            }
-
-            const unsigned int neighbor_cell_index = m_linkcell->getCellIndex(
-                vec3<int>(point_cell.x, point_cell.y, point_cell.z) + (*m_neigh_cell_iter));
-            // Insertion to an unordered set returns a pair, the second
-            // element indicates insertion success or failure (if it
-            // already exists)
-            if (m_searched_cells.insert(neighbor_cell_index).second)
-            {
-                // This cell has not been searched yet, so we will iterate
-                // over its contents. Otherwise, we loop back, increment
-                // the cell shell iterator, and try the next one.
-                m_cell_iter = m_linkcell->itercell(neighbor_cell_index);
-                break;
-            }
+            break;
+        }
+        while (m_stencil_idx >= stencil_shells[m_shell + 1])
+        {
+            ++m_shell;
         }
-        if (out_of_range)
+        if (static_cast<float>(static_cast<int>(m_shell) - m_extra_search_width) * m_linkcell->getCellWidth()
+            > m_r_max)
         {
             break;
         }
+
+        m_cell_iter = m_linkcell->itercell(m_linkcell->getCellIndex(
+            vec3<int>(point_cell.x, point_cell.y, point_cell.z) + stencil[m_stencil_idx]));
     }
 
     m_finished = true;
@@ -575,25 +631,34 @@ NeighborBond LinkCellQueryIterator::next()
     unsigned int max_range
         = static_cast<unsigned int>(std::ceil(min_plane_distance / (2 * m_linkcell->getCellWidth()))) + 1;
 
+    const std::vector<vec3<int>>& stencil = m_linkcell->getStencil();
+    const std::vector<unsigned int>& stencil_shells = m_linkcell->getStencilShells();
+    const unsigned int num_shells
+        = std::min(max_range, static_cast<unsigned int>(stencil_shells.size() - 1));
     vec3<unsigned int> point_cell(m_linkcell->getCellCoord(m_query_point));
-    const unsigned int point_cell_index = m_linkcell->getCellIndex(
-        vec3<int>(point_cell.x, point_cell.y, point_cell.z) + (*m_neigh_cell_iter));
-    m_searched_cells.insert(point_cell_index);
 
-    // Loop over cell list neighbor shells relative to this point's cell.
+    // Loop over the neighbor cell stencil relative to this point's cell.
     if (m_current_neighbors.empty())
     {
         // Expand search cell radius until termination conditions are met.
-        while (m_neigh_cell_iter != IteratorCellShell(max_range, m_neighbor_query->getBox().is2D()))
+        for (; m_shell < num_shells; ++m_shell)
         {
-            // Iterate over the particles in that cell. Using a local counter
-            // variable is safe, because the IteratorLinkCell object is keeping
-            // track between calls to next. However, we have to add an extra
-            // check outside to proof ourselves against returning after
-            // previous calls to next that have not yet reset the iterator.
-            if (!m_cell_iter.atEnd())
+            // We can terminate early if we determine when we reach a shell
+            // such that we already have k neighbors closer than the
+            // closest possible neighbor in the new shell.
+            if ((m_current_neighbors.size() >= m_num_neighbors)
+                && (m_current_neighbors[m_num_neighbors - 1].distance
+                    < static_cast<float>(static_cast<int>(m_shell) - 1) * m_linkcell->getCellWidth()))
+            {
+                break;
+            }
+
+            for (m_stencil_idx = stencil_shells[m_shell]; m_stencil_idx != stencil_shells[m_shell + 1];
+                 ++m_stencil_idx)
             {
-                for (unsigned int j = m_cell_iter.next(); !m_cell_iter.atEnd(); j = m_cell_iter.next())
+                IteratorLinkCell cell_iter = m_linkcell->itercell(m_linkcell->getCellIndex(
+                    vec3<int>(point_cell.x, point_cell.y, point_cell.z) + stencil[m_stencil_idx]));
+                for (unsigned int j = cell_iter.next(); !cell_iter.atEnd(); j = cell_iter.next())
                 {
                     // Skip ii matches immediately if requested.
                     if (m_exclude_ii && m_query_point_idx == j)
@@ -608,42 +673,7 @@ NeighborBond LinkCellQueryIterator::next()
                     }
                 }
             }
-
-            while (true)
-            {
-                ++m_neigh_cell_iter;
-
-                if (m_neigh_cell_iter == IteratorCellShell(max_range, m_neighbor_query->getBox().is2D()))
-                {
-                    break;
-                }
-
-                const unsigned int neighbor_cell_index = m_linkcell->getCellIndex(
-                    vec3<int>(point_cell.x, point_cell.y, point_cell.z) + (*m_neigh_cell_iter));
-                // Insertion to an unordered set returns a pair, the second
-                // element indicates insertion success or failure (if it
-                // already exists)
-                if (m_searched_cells.insert(neighbor_cell_index).second)
-                {
-                    // This cell has not been searched yet, so we will
-                    // iterate over its contents. Otherwise, we loop back,
-                    // increment the cell shell iterator, and try the next
-                    // one.
-                    m_cell_iter = m_linkcell->itercell(neighbor_cell_index);
-                    break;
-                }
-            }
-
-            // We can terminate early if we determine when we reach a shell
-            // such that we already have k neighbors closer than the
-            // closest possible neighbor in the new shell.
             std::sort(m_current_neighbors.begin(), m_current_neighbors.end());
-            if ((m_current_neighbors.size() >= m_num_neighbors)
-                && (m_current_neighbors[m_num_neighbors - 1].distance
-                    < static_cast<float>(m_neigh_cell_iter.getRange() - 1) * m_linkcell->getCellWidth()))
-            {
-                break;
-            }
         }
     }
 
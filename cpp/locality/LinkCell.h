@@ -4,9 +4,8 @@
 #ifndef LINKCELL_H
 #define LINKCELL_H
 
+#include <algorithm>
 #include <memory>
-#include <tbb/concurrent_hash_map.h>
-#include <unordered_set>
 #include <vector>
 
 #include "Box.h"
@@ -20,21 +19,19 @@
 namespace freud { namespace locality {
 
 /*! \internal
-    \brief Signifies the end of the linked list
+    \brief Signifies the end of the iteration over a cell
 */
 const unsigned int LINK_CELL_TERMINATOR = 0xffffffff;
 
-//! Iterates over particles in a link cell list generated by LinkCell
-/*! The link-cell structure is not trivial to iterate over. This helper class
- *  makes that easier both in C++ and provides a Python compatible interface
- *  for direct usage there. An IteratorLinkCell is given the bare essentials
- *  it needs to iterate over a given cell, the cell list, the number of
- *  particles, number of cells and the cell to iterate over. Call next() to
+//! Iterates over particles in a cell list generated by LinkCell
+/*! This helper class makes it easy to iterate over the particles in a cell
+ *  both in C++ and provides a Python compatible interface for direct usage
+ *  there. An IteratorLinkCell is given the bare essentials it needs to
+ *  iterate over a given cell: the original indices of the points in cell
+ *  order and the range of that array belonging to the cell. Call next() to
  *  get the index of the next particle in the cell, atEnd() will return true
- *  if you are at the end. In C++, next() will crash the code if you attempt
- *  to iterate past the end (no bounds checking for performance). When called
- *  from Python, a different version of next() is used that will throw
- *  StopIteration at the end.
+ *  if you are at the end. When called from Python, a different version of
+ *  next() is used that will throw StopIteration at the end.
  *
  *  A loop over all of the particles in a cell can be accomplished with the
  *   following code in C++.
@@ -54,13 +51,11 @@ class IteratorLinkCell
 public:
     IteratorLinkCell() = default;
 
-    IteratorLinkCell(const util::ManagedArray<unsigned int>& cell_list, unsigned int Np, unsigned int Nc,
-                     unsigned int cell)
-        : m_cell_list(cell_list), m_Np(Np), m_Nc(Nc)
-    {
-        m_cell = cell;
-        m_cur_idx = m_Np + cell;
-    }
+    IteratorLinkCell(const util::ManagedArray<unsigned int>& cell_point_ids, unsigned int cell_begin,
+                     unsigned int cell_end)
+        : m_cell_point_ids(cell_point_ids), m_cell_begin(cell_begin), m_cell_end(cell_end),
+          m_next(cell_begin), m_cur_idx(cell_begin)
+    {}
 
     //! Copy the position of rhs into this object
     void copy(const IteratorLinkCell& rhs);
@@ -75,11 +70,11 @@ public:
     unsigned int begin();
 
 private:
-    util::ManagedArray<unsigned int> m_cell_list;  //!< The cell list
-    unsigned int m_Np {0};                         //!< Number of particles in the cell list
-    unsigned int m_Nc {0};                         //!< Number of cells in the cell list
-    unsigned int m_cur_idx {LINK_CELL_TERMINATOR}; //!< Current index
-    unsigned int m_cell {0};                       //!< Cell being considered
+    util::ManagedArray<unsigned int> m_cell_point_ids; //!< Original point indices in cell order
+    unsigned int m_cell_begin {0};                     //!< First position of the cell in cell order
+    unsigned int m_cell_end {0};                       //!< One past the last position of the cell
+    unsigned int m_next {0};                           //!< Position of the next particle in cell order
+    unsigned int m_cur_idx {LINK_CELL_TERMINATOR};     //!< Current particle index
 };
 
 //! Iterates over sets of shells in a cell list
@@ -148,8 +143,8 @@ private:
 };
 
 //! Computes a cell id for each particle and a link cell data structure for iterating through it
-/*! For simplicity in only needing a small number of arrays, the link cell
- *  algorithm is used to generate and store the cell list data for particles.
+/*! Points are binned into cells and sorted by cell, so that all points in
+ *  a cell are stored contiguously.
 
  *  Cells are given a nominal minimum width \a cell_width. Each dimension of
  *  the box is split into an integer number of cells no smaller than
@@ -165,8 +160,24 @@ private:
  *  an arbitrary point.
 
  *  <b>Data structures:</b><br>
- *  The internal data structure used in LinkCell is a linked list of particle
- *  indices. See IteratorLinkCell for information on how to iterate through these.
+ *  The cell list is built with a parallel counting sort of the points by
+ *  cell. The points of cell c occupy the positions [offsets[c], offsets[c+1])
+ *  of the cell-ordered arrays, which hold a copy of each point's position
+ *  and its original index. Scanning a cell therefore reads contiguous
+ *  memory, and results are reported using the original indices. Within a
+ *  cell, points remain sorted by their original index. See IteratorLinkCell
+ *  for information on how to iterate through a cell.
+
+ *  Neighboring cells are found using a stencil of cell offsets that is
+ *  computed once at construction. The stencil lists the offsets of each
+ *  shell produced by IteratorCellShell in order, but omits any offset that
+ *  wraps around the periodic cell list onto a cell already in the stencil.
+ *  Offsets are only generated within half the cell list of zero in each
+ *  dimension, so building the stencil takes time proportional to the number
+ *  of cells even when one dimension has far more cells than the others.
+ *  Since whether two offsets wrap onto the same cell does not depend on the
+ *  starting cell, queries never visit a cell twice without having to track
+ *  visited cells. The stencil ends once every cell has been covered.
 
  *  <b>2D:</b><br>
  *  LinkCell properly handles 2D boxes. When a 2D box is handed to LinkCell,
@@ -221,11 +232,23 @@ public:
     //! Iterate over particles in a cell
     IteratorLinkCell itercell(unsigned int cell) const
     {
-        return IteratorLinkCell(m_cell_list, m_n_points, getNumCells(), cell);
+        return IteratorLinkCell(m_cell_point_ids, m_cell_offsets[cell], m_cell_offsets[cell + 1]);
+    }
+
+    //! Get a sorted list of the cells neighboring a cell, including itself
+    std::vector<unsigned int> getCellNeighbors(unsigned int cell) const;
+
+    //! Get the cell offsets of the neighbor cell stencil
+    const std::vector<vec3<int>>& getStencil() const
+    {
+        return m_stencil;
     }
 
-    //! Get a list of neighbors to a cell
-    const std::vector<unsigned int>& getCellNeighbors(unsigned int cell) const;
+    //! Get the start of each shell in the stencil, followed by the stencil size
+    const std::vector<unsigned int>& getStencilShells() const
+    {
+        return m_stencil_shells;
+    }
 
     //! Compute the cell list
     void computeCellList(const vec3<float>* points, unsigned int n_points);
@@ -238,17 +261,32 @@ public:
     std::shared_ptr<NeighborQueryPerPointIterator>
     querySingle(const vec3<float> query_point, unsigned int query_point_idx, QueryArgs args) const override;
 
+    //! Implementation of the visitor query for LinkCell (see NeighborQuery.h for documentation).
+    /*! Ball queries walk the cell shells directly for each query point, so no
+     *  per-point iterators are allocated.
+     */
+    template<typename Visitor>
+    void forEachNeighbor(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                         const Visitor& visit, bool parallel = true) const;
+
 private:
-    //! Helper function to compute cell neighbors
-    const std::vector<unsigned int>& computeCellNeighbors(unsigned int cell) const;
+    //! Visit all neighbors of a single point within a ball.
+    template<typename Visitor>
+    void visitBall(const vec3<float>& query_point, unsigned int query_point_idx, float r_max, float r_min,
+                   bool exclude_ii, bool half_list, const Visitor& visit) const;
+
+    //! Compute the neighbor cell stencil
+    void computeStencil();
 
     float m_cell_width {0};                 //!< Minimum necessary cell width cutoff
     vec3<unsigned int> m_celldim {0, 0, 0}; //!< Cell dimensions
     unsigned int m_size {0};                //!< The size of cell list.
 
-    util::ManagedArray<unsigned int> m_cell_list; //!< The cell list last computed
-    using CellNeighbors = tbb::concurrent_hash_map<unsigned int, std::vector<unsigned int>>;
-    mutable CellNeighbors m_cell_neighbors; //!< Hash map of cell neighbors for each cell
+    util::ManagedArray<unsigned int> m_cell_offsets;   //!< Start of each cell in cell order, plus the end
+    util::ManagedArray<unsigned int> m_cell_point_ids; //!< Original point indices in cell order
+    util::ManagedArray<vec3<float>> m_cell_points;     //!< Point positions in cell order
+    std::vector<vec3<int>> m_stencil;                  //!< Cell offsets of all shells, without duplicates
+    std::vector<unsigned int> m_stencil_shells;        //!< Start of each shell in m_stencil, plus the end
 };
 
 //! Parent class of LinkCell iterators that knows how to traverse general cell-linked list structures.
@@ -260,23 +298,21 @@ public:
      *  iterate outwards from there.
      */
     LinkCellIterator(const LinkCell* neighbor_query, const vec3<float>& query_point,
-                     unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii)
+                     unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii,
+                     bool half_list = false)
         : NeighborQueryPerPointIterator(neighbor_query, query_point, query_point_idx, r_max, r_min,
-                                        exclude_ii),
-          m_linkcell(neighbor_query), m_neigh_cell_iter(0, neighbor_query->getBox().is2D()),
-          m_cell_iter(m_linkcell->itercell(m_linkcell->getCell(m_query_point)))
+                                        exclude_ii, half_list),
+          m_linkcell(neighbor_query), m_cell_iter(m_linkcell->itercell(m_linkcell->getCell(m_query_point)))
     {}
 
     //! Empty Destructor
     ~LinkCellIterator() override = default;
 
 protected:
-    const LinkCell* m_linkcell; //!< Link to the LinkCell object
-    IteratorCellShell
-        m_neigh_cell_iter;        //!< The shell iterator indicating how far out we're currently searching.
-    IteratorLinkCell m_cell_iter; //!< The cell iterator indicating which cell we're currently searching.
-    std::unordered_set<unsigned int>
-        m_searched_cells; //!< Set of cells that have already been searched by the cell shell iterator.
+    const LinkCell* m_linkcell;     //!< Link to the LinkCell object
+    unsigned int m_stencil_idx {0}; //!< Index of the stencil offset of the cell currently being searched.
+    unsigned int m_shell {0};       //!< The shell of the stencil currently being searched.
+    IteratorLinkCell m_cell_iter;   //!< The cell iterator indicating which cell we're currently searching.
 };
 
 //! Iterator that gets specified numbers of nearest neighbors from LinkCell tree structures.
@@ -309,8 +345,9 @@ class LinkCellQueryBallIterator : public LinkCellIterator
 public:
     //! Constructor
     LinkCellQueryBallIterator(const LinkCell* neighbor_query, const vec3<float>& query_point,
-                              unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii)
-        : LinkCellIterator(neighbor_query, query_point, query_point_idx, r_max, r_min, exclude_ii)
+                              unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii,
+                              bool half_list = false)
+        : LinkCellIterator(neighbor_query, query_point, query_point_idx, r_max, r_min, exclude_ii, half_list)
     {
         // Upon querying, if the search radius is equal to the cell width, we
         // can guarantee that we don't need to search the cell shell past the
@@ -334,6 +371,93 @@ public:
 protected:
     int m_extra_search_width; //!< The extra shell distance to search, always 0 or 1.
 };
+
+template<typename Visitor>
+void LinkCell::forEachNeighbor(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                               const Visitor& visit, bool parallel) const
+{
+    validatePeriodic();
+    this->validateQueryArgs(qargs);
+    validateHalfList(query_points, n_query_points, qargs);
+
+    // Self-queries are processed in cell order, so that consecutive query
+    // points search the same cells.
+    const unsigned int* order
+        = (query_points == m_points && n_query_points == m_n_points) ? m_cell_point_ids.get() : nullptr;
+    util::forLoopWrapper(
+        0, n_query_points,
+        [&](size_t begin, size_t end) {
+            for (size_t idx = begin; idx != end; ++idx)
+            {
+                const size_t i = (order != nullptr) ? order[idx] : idx;
+                if (qargs.mode == QueryType::ball)
+                {
+                    visitBall(query_points[i], i, qargs.r_max, qargs.r_min, qargs.exclude_ii, qargs.half_list,
+                              visit);
+                }
+                else
+                {
+                    std::shared_ptr<NeighborQueryPerPointIterator> it
+                        = querySingle(query_points[i], i, qargs);
+                    NeighborBond nb = it->next();
+                    while (!it->end())
+                    {
+                        visit(nb);
+                        nb = it->next();
+                    }
+                }
+            }
+        },
+        parallel);
+}
+
+template<typename Visitor>
+void LinkCell::visitBall(const vec3<float>& query_point, unsigned int query_point_idx, float r_max,
+                         float r_min, bool exclude_ii, bool half_list, const Visitor& visit) const
+{
+    const float r_max_sq = r_max * r_max;
+    const float r_min_sq = r_min * r_min;
+    const unsigned int* cell_offsets = m_cell_offsets.get();
+    const unsigned int* cell_point_ids = m_cell_point_ids.get();
+    const vec3<float>* cell_points = m_cell_points.get();
+
+    // If the search radius is equal to the cell width, we can guarantee that
+    // we don't need to search the cell shell past the query radius.
+    const int extra_search_width = (r_max == m_cell_width) ? 0 : 1;
+
+    const vec3<unsigned int> point_cell(getCellCoord(query_point));
+    const vec3<int> point_cell_coord(point_cell.x, point_cell.y, point_cell.z);
+    const unsigned int num_shells = m_stencil_shells.size() - 1;
+    for (unsigned int shell = 0; shell < num_shells; ++shell)
+    {
+        if (static_cast<float>(static_cast<int>(shell) - extra_search_width) * m_cell_width > r_max)
+        {
+            break;
+        }
+
+        for (unsigned int stencil_idx = m_stencil_shells[shell]; stencil_idx != m_stencil_shells[shell + 1];
+             ++stencil_idx)
+        {
+            const unsigned int cell = getCellIndex(point_cell_coord + m_stencil[stencil_idx]);
+            for (unsigned int slot = cell_offsets[cell]; slot != cell_offsets[cell + 1]; ++slot)
+            {
+                const unsigned int j = cell_point_ids[slot];
+                if (excludeNeighborIndex(query_point_idx, j, exclude_ii, half_list))
+                {
+                    continue;
+                }
+
+                const vec3<float> r_ij(m_box.wrap(cell_points[slot] - query_point));
+                const float r_sq(dot(r_ij, r_ij));
+                if (r_sq < r_max_sq && r_sq >= r_min_sq)
+                {
+                    visit(NeighborBond(query_point_idx, j, std::sqrt(r_sq)));
+                }
+            }
+        }
+    }
+}
+
 }; }; // end namespace freud::locality
 
 #endif // LINKCELL_H
@@ -10,6 +10,8 @@ NeighborList makeDefaultNlist(const NeighborQuery* nq, const NeighborList* nlist
                               const vec3<float>* query_points, unsigned int num_query_points,
                               locality::QueryArgs qargs)
 {
+    validateFullNeighborList(nlist, qargs);
+
     bool requires_delete(false);
     if (nlist == nullptr)
     {
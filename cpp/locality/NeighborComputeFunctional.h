@@ -2,11 +2,14 @@
 #define NEIGHBOR_COMPUTE_FUNCTIONAL_H
 
 #include <memory>
+#include <stdexcept>
 
 #include "AABBQuery.h"
+#include "LinkCell.h"
 #include "NeighborList.h"
 #include "NeighborPerPointIterator.h"
 #include "NeighborQuery.h"
+#include "RawPoints.h"
 #include "utils.h"
 
 /*! \file NeighborComputeFunctional.h
@@ -15,10 +18,27 @@
 
 namespace freud { namespace locality {
 
+//! Raise an error if the neighbors to loop over form a half neighbor list.
+/*! A half list holds each pair of neighbors only once, so computes that need
+ * all bonds of every query point would silently miss half of them. Only
+ * computes that treat both ends of a bond alike may accept half lists.
+ *
+ * \param nlist Neighbor List. If not NULL, its flag is checked. Otherwise, qargs are checked.
+ * \param qargs Query arguments.
+ */
+inline void validateFullNeighborList(const NeighborList* nlist, const QueryArgs& qargs)
+{
+    if ((nlist != nullptr) ? nlist->getHalfList() : qargs.half_list)
+    {
+        throw std::invalid_argument("This compute requires a full neighbor list, so half neighbor lists "
+                                    "cannot be used.");
+    }
+}
+
 //! Make a default NeighborList object to use.
 /*! This function makes a NeighborList from the provided NeighborQuery object
  * if the provided NeighborList is NULL. Otherwise, it simply returns a copy of
- * the provided NeighborList.
+ * the provided NeighborList. Half neighbor lists are rejected.
  */
 NeighborList makeDefaultNlist(const NeighborQuery* nq, const NeighborList* nlist,
                               const vec3<float>* query_points, unsigned int num_query_points,
@@ -38,29 +58,25 @@ inline vec3<float> bondVector(const NeighborBond& nb, const NeighborQuery* nq,
 //! Implementation of per-point finding logic for NeighborList objects.
 /*! This class provides a concrete implementation of the per-point neighbor
  *  finding interface specified by the NeighborPerPointIterator. In particular,
- *  it includes the logic for finding neighbors within a NeighborList by using
- *  the find_first_index method to initialize a start index and looping over all
- *  neighbors in the NeighborList.
+ *  it uses the CSR offsets of the NeighborList to find the range of bonds
+ *  belonging to the point in constant time and loops over that range.
  */
 class NeighborListPerPointIterator : public NeighborPerPointIterator
 {
 public:
     NeighborListPerPointIterator(const NeighborList* nlist, size_t point_index)
-        : NeighborPerPointIterator(point_index), m_nlist(nlist)
+        : NeighborPerPointIterator(point_index), m_nlist(nlist),
+          m_current_index(m_nlist->find_first_index(point_index)),
+          m_end_index(m_nlist->find_first_index(point_index + 1))
     {
-        m_current_index = m_nlist->find_first_index(point_index);
-        m_finished = m_current_index == m_nlist->getNumBonds();
-        if (!m_finished)
-        {
-            m_returned_point_index = m_nlist->getNeighbors()(m_current_index, 0);
-        }
+        m_finished = m_current_index >= m_end_index;
     }
 
     ~NeighborListPerPointIterator() override = default;
 
     NeighborBond next() override
     {
-        if (m_current_index == m_nlist->getNumBonds())
+        if (m_current_index >= m_end_index)
         {
             m_finished = true;
             return ITERATOR_TERMINATOR;
@@ -70,23 +86,19 @@ public:
             m_nlist->getNeighbors()(m_current_index, 0), m_nlist->getNeighbors()(m_current_index, 1),
             m_nlist->getDistances()[m_current_index], m_nlist->getWeights()[m_current_index]);
         ++m_current_index;
-        m_returned_point_index = nb.query_point_idx;
         return nb;
     }
 
     bool end() const override
     {
-        return (m_returned_point_index != m_query_point_idx) || m_finished;
+        return m_finished;
     }
 
 private:
     const NeighborList* m_nlist; //! The NeighborList being iterated over.
     size_t m_current_index;      //! The row of m_nlist where the iterator is currently located.
-    size_t m_returned_point_index {
-        0xffffffff}; //! The index of the last returned point (i.e. the value of
-                     //! m_nlist.getNeighbors()(m_current_index, 0)). Initialized to an arbitrary sentinel in
-                     //! case the user ever tries to access this for an iterator built from an empty nlist.
-    bool m_finished; //! Flag to indicate that the iterator has been exhausted.
+    size_t m_end_index;          //! One past the last row of m_nlist belonging to this point.
+    bool m_finished;             //! Flag to indicate that the iterator has been exhausted.
 };
 
 //! Wrapper iterating looping over NeighborQuery or NeighborList.
@@ -118,6 +130,8 @@ void loopOverNeighborsIterator(const NeighborQuery* neighbor_query, const vec3<f
                                unsigned int n_query_points, QueryArgs qargs, const NeighborList* nlist,
                                const ComputePairType& cf, bool parallel = true)
 {
+    validateFullNeighborList(nlist, qargs);
+
     // check if nlist exists
     if (nlist != nullptr)
     {
@@ -162,9 +176,10 @@ void loopOverNeighborsIterator(const NeighborQuery* neighbor_query, const vec3<f
  *
  *  This function is designed for computations that can simplify accumulate
  *  over all neighbor pairs. As a result, the provided compute function is
- *  simply applied to all pairs, allowing maximum parallelism. The actual logic
- *  for the NeighborList vs NeighborQuery code paths are handled in helper
- *  functions.
+ *  simply applied to all pairs, allowing maximum parallelism. When no
+ *  NeighborList is provided, the query is performed with the forEachNeighbor
+ *  visitor of the concrete NeighborQuery type, which avoids allocating
+ *  per-point iterators for the common AABBQuery and LinkCell cases.
  *
  *  \param neighbor_query NeighborQuery object to iterate over.
  *  \param query_points Query points to perform computation on.
@@ -172,12 +187,20 @@ void loopOverNeighborsIterator(const NeighborQuery* neighbor_query, const vec3<f
  *  \param qargs Query arguments.
  *  \param nlist Neighbor List. If not NULL, loop over it. Otherwise, use neighbor_query appropriately with
  * given qargs. \param cf An object with operator(NeighborBond) as input.
+ *  \param parallel If true, bonds are processed in parallel.
+ *  \param allow_half_list If true, half neighbor lists are accepted. This is
+ *         only correct for computes that treat both ends of a bond alike.
  */
 template<typename ComputePairType>
 void loopOverNeighbors(const NeighborQuery* neighbor_query, const vec3<float>* query_points,
                        unsigned int n_query_points, QueryArgs qargs, const NeighborList* nlist,
-                       const ComputePairType& cf, bool parallel = true)
+                       const ComputePairType& cf, bool parallel = true, bool allow_half_list = false)
 {
+    if (!allow_half_list)
+    {
+        validateFullNeighborList(nlist, qargs);
+    }
+
     // check if nlist exists
     if (nlist != nullptr)
     {
@@ -193,28 +216,21 @@ void loopOverNeighbors(const NeighborQuery* neighbor_query, const vec3<float>* q
             },
             parallel);
     }
+    else if (const auto* aq = dynamic_cast<const AABBQuery*>(neighbor_query))
+    {
+        aq->forEachNeighbor(query_points, n_query_points, qargs, cf, parallel);
+    }
+    else if (const auto* lc = dynamic_cast<const LinkCell*>(neighbor_query))
+    {
+        lc->forEachNeighbor(query_points, n_query_points, qargs, cf, parallel);
+    }
+    else if (const auto* rp = dynamic_cast<const RawPoints*>(neighbor_query))
+    {
+        rp->forEachNeighbor(query_points, n_query_points, qargs, cf, parallel);
+    }
     else
     {
-        std::shared_ptr<NeighborQueryIterator> iter
-            = neighbor_query->query(query_points, n_query_points, qargs);
-
-        // iterate over the query object in parallel
-        util::forLoopWrapper(
-            0, n_query_points,
-            [&iter, &cf](size_t begin, size_t end) {
-                NeighborBond nb;
-                for (size_t i = begin; i != end; ++i)
-                {
-                    std::shared_ptr<NeighborQueryPerPointIterator> it = iter->query(i);
-                    nb = it->next();
-                    while (!it->end())
-                    {
-                        cf(nb);
-                        nb = it->next();
-                    }
-                }
-            },
-            parallel);
+        neighbor_query->forEachNeighbor(query_points, n_query_points, qargs, cf, parallel);
     }
 }
 
@@ -4,31 +4,49 @@
 #include <algorithm>
 
 #include "NeighborList.h"
+#include "utils.h"
 
 namespace freud { namespace locality {
 
 NeighborList::NeighborList()
     : m_num_query_points(0), m_num_points(0), m_neighbors({0, 2}), m_distances(0), m_weights(0),
-      m_segments_counts_updated(false)
+      m_half_list(false), m_offsets_updated(false), m_segments_counts_updated(false)
 {}
 
 NeighborList::NeighborList(unsigned int num_bonds)
     : m_num_query_points(0), m_num_points(0), m_neighbors({num_bonds, 2}), m_distances(num_bonds),
-      m_weights(num_bonds), m_segments_counts_updated(false)
+      m_weights(num_bonds), m_half_list(false), m_offsets_updated(false), m_segments_counts_updated(false)
 {}
 
 NeighborList::NeighborList(const NeighborList& other)
-    : m_num_query_points(other.m_num_query_points), m_num_points(other.m_num_points),
-      m_segments_counts_updated(false)
+    : m_num_query_points(other.m_num_query_points), m_num_points(other.m_num_points), m_half_list(false),
+      m_offsets_updated(false), m_segments_counts_updated(false)
 {
     copy(other);
 }
 
+NeighborList& NeighborList::operator=(const NeighborList& other)
+{
+    if (this != &other)
+    {
+        m_num_query_points = other.m_num_query_points;
+        m_num_points = other.m_num_points;
+        m_neighbors = other.m_neighbors;
+        m_distances = other.m_distances;
+        m_weights = other.m_weights;
+        m_half_list = other.m_half_list;
+        m_offsets_updated = false;
+        m_segments_counts_updated = false;
+    }
+    return *this;
+}
+
 NeighborList::NeighborList(unsigned int num_bonds, const unsigned int* query_point_index,
                            unsigned int num_query_points, const unsigned int* point_index,
                            unsigned int num_points, const float* distances, const float* weights)
     : m_num_query_points(num_query_points), m_num_points(num_points), m_neighbors({num_bonds, 2}),
-      m_distances(num_bonds), m_weights(num_bonds), m_segments_counts_updated(false)
+      m_distances(num_bonds), m_weights(num_bonds), m_half_list(false), m_offsets_updated(false),
+      m_segments_counts_updated(false)
 {
     unsigned int last_index(0);
     for (unsigned int i = 0; i < num_bonds; i++)
@@ -75,39 +93,68 @@ void NeighborList::setNumBonds(unsigned int num_bonds, unsigned int num_query_po
     resize(num_bonds);
     m_num_query_points = num_query_points;
     m_num_points = num_points;
+    m_offsets_updated = false;
     m_segments_counts_updated = false;
 }
 
+void NeighborList::updateOffsets() const
+{
+    if (m_offsets_updated)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_offsets_mutex);
+    if (m_offsets_updated)
+    {
+        return;
+    }
+
+    const unsigned int num_bonds = getNumBonds();
+    m_offsets.prepare(m_num_query_points + 1);
+
+    // Since bonds are sorted by query point index, the offset of query point
+    // i is the index of the first bond whose query point index is at least i.
+    // Each bond sets the offsets of the query points between its predecessor's
+    // query point and its own, so every offset is written exactly once.
+    util::forLoopWrapper(0, num_bonds, [&](size_t begin, size_t end) {
+        for (size_t bond = begin; bond < end; ++bond)
+        {
+            const unsigned int first
+                = (bond == 0) ? 0 : std::min(m_neighbors(bond - 1, 0) + 1, m_num_query_points + 1);
+            const unsigned int last = std::min(m_neighbors(bond, 0), m_num_query_points);
+            for (unsigned int i = first; i <= last; ++i)
+            {
+                m_offsets[i] = bond;
+            }
+        }
+    });
+
+    // Query points after the last bonded query point have no bonds.
+    const unsigned int tail_begin
+        = (num_bonds == 0) ? 0 : std::min(m_neighbors(num_bonds - 1, 0) + 1, m_num_query_points + 1);
+    for (unsigned int i = tail_begin; i <= m_num_query_points; ++i)
+    {
+        m_offsets[i] = num_bonds;
+    }
+
+    m_offsets_updated = true;
+}
+
 void NeighborList::updateSegmentCounts() const
 {
+    updateOffsets();
+    std::lock_guard<std::mutex> lock(m_offsets_mutex);
     if (!m_segments_counts_updated)
     {
         m_counts.prepare(m_num_query_points);
         m_segments.prepare(m_num_query_points);
-        int last_index(-1);
-        unsigned int counter(0);
-        for (unsigned int i = 0; i < getNumBonds(); i++)
-        {
-            const int index = m_neighbors(i, 0);
-            if (index != last_index)
+        util::forLoopWrapper(0, m_num_query_points, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
             {
-                m_segments[index] = i;
-                if (index > 0)
-                {
-                    if (last_index >= 0)
-                    {
-                        m_counts[last_index] = counter;
-                    }
-                    counter = 0;
-                }
+                m_segments[i] = m_offsets[i];
+                m_counts[i] = m_offsets[i + 1] - m_offsets[i];
             }
-            last_index = index;
-            counter++;
-        }
-        if (last_index >= 0)
-        {
-            m_counts[last_index] = counter;
-        }
+        });
         m_segments_counts_updated = true;
     }
 }
@@ -149,6 +196,7 @@ template<typename Iterator> unsigned int NeighborList::filter(Iterator begin)
     m_neighbors = new_neighbors;
     m_distances = new_distances;
     m_weights = new_weights;
+    m_offsets_updated = false;
     m_segments_counts_updated = false;
     return old_size - new_size;
 }
@@ -172,6 +220,10 @@ unsigned int NeighborList::filter_r(float r_max, float r_min)
 
 unsigned int NeighborList::find_first_index(unsigned int i) const
 {
+    if (i <= m_num_query_points)
+    {
+        return getOffsets()[i];
+    }
     if (getNumBonds() != 0)
     {
         return bisection_search(i, 0, getNumBonds()) + (i > m_neighbors(0, 0) ? 1 : 0);
@@ -200,6 +252,7 @@ void NeighborList::resize(unsigned int num_bonds)
     m_neighbors = new_neighbors;
     m_distances = new_distances;
     m_weights = new_weights;
+    m_offsets_updated = false;
     m_segments_counts_updated = false;
 }
 
@@ -209,6 +262,8 @@ void NeighborList::copy(const NeighborList& other)
     m_neighbors = other.m_neighbors.copy();
     m_weights = other.m_weights.copy();
     m_distances = other.m_distances.copy();
+    m_half_list = other.m_half_list;
+    m_offsets_updated = false;
     m_segments_counts_updated = false;
 }
 
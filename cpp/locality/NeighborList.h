@@ -4,6 +4,8 @@
 #ifndef NEIGHBOR_LIST_H
 #define NEIGHBOR_LIST_H
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #include "Box.h"
@@ -23,6 +25,20 @@ namespace freud { namespace locality {
 
     Query point and point indices are stored in a 2D array m_neighbors of shape
     (n_bonds, 2). The distances and weights arrays are flat per-bond arrays.
+
+    Bonds are sorted by query point index, so the bonds of each query point
+    form a contiguous segment. These segments are also stored in compressed
+    sparse row (CSR) form as an offsets array of length n_query_points + 1,
+    where the bonds of query point i occupy the indices [offsets[i],
+    offsets[i+1]). The offsets are computed in parallel and cached until the
+    bonds change, so finding the bonds of any query point takes constant time.
+
+    <b>Half lists:</b>
+
+    When the query points and points are the same set, a NeighborList may
+    store each pair of neighbors only once, as the bond (i, j) with i < j.
+    Such lists are flagged as half lists so that symmetric computes can
+    account for the missing (j, i) bonds.
  */
 class NeighborList
 {
@@ -33,6 +49,8 @@ public:
     explicit NeighborList(unsigned int num_bonds);
     //! Copy constructor (makes a deep copy)
     NeighborList(const NeighborList& other);
+    //! Copy assignment (shares the underlying bond arrays)
+    NeighborList& operator=(const NeighborList& other);
     //! Construct from arrays
     NeighborList(unsigned int num_bonds, const unsigned int* query_point_index, unsigned int num_query_points,
                  const unsigned int* point_index, unsigned int num_points, const float* distances,
@@ -47,6 +65,19 @@ public:
 
     //! Set the number of bonds, query points, and points for this NeighborList object
     void setNumBonds(unsigned int num_bonds, unsigned int num_query_points, unsigned int num_points);
+    //! Return whether this NeighborList stores only bonds with i < j
+    bool getHalfList() const
+    {
+        return m_half_list;
+    }
+    //! Set whether this NeighborList stores only bonds with i < j
+    void setHalfList(bool half_list)
+    {
+        m_half_list = half_list;
+    }
+
+    //! Update the CSR offsets array
+    void updateOffsets() const;
     //! Update the arrays of neighbor counts and segments
     void updateSegmentCounts() const;
 
@@ -105,6 +136,12 @@ public:
         updateSegmentCounts();
         return m_segments;
     }
+    //! Access the CSR offsets array for reading
+    const util::ManagedArray<unsigned int>& getOffsets() const
+    {
+        updateOffsets();
+        return m_offsets;
+    }
 
     //! Remove bonds in this object based on an array of boolean values. The
     //  array must be at least as long as the number of neighbor bonds.
@@ -140,9 +177,17 @@ private:
     util::ManagedArray<float> m_distances;
     //! Neighbor list per-bond weight array
     util::ManagedArray<float> m_weights;
+    //! Whether only bonds with i < j are stored
+    bool m_half_list;
 
+    //! Track whether the offsets are up to date
+    mutable std::atomic<bool> m_offsets_updated;
     //! Track whether segments and counts are up to date
     mutable bool m_segments_counts_updated;
+    //! Serializes the lazy construction of offsets, segments, and counts
+    mutable std::mutex m_offsets_mutex;
+    //! CSR offsets of the bonds of each query point
+    mutable util::ManagedArray<unsigned int> m_offsets;
     //! Neighbor counts for each query point
     mutable util::ManagedArray<unsigned int> m_counts;
     //! Neighbor segments for each query point
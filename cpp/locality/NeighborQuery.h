@@ -4,11 +4,13 @@
 #ifndef NEIGHBOR_QUERY_H
 #define NEIGHBOR_QUERY_H
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <tbb/enumerable_thread_specific.h>
-#include <tbb/parallel_sort.h>
 #include <utility>
+#include <vector>
 
 #include "Box.h"
 #include "NeighborBond.h"
@@ -38,9 +40,24 @@ constexpr float DEFAULT_R_MIN(0);                         //!< Default minimum q
 constexpr float DEFAULT_R_GUESS(-1.0);                    //!< Default guess query distance.
 constexpr float DEFAULT_SCALE(-1.0);      //!< Default scaling parameter for AABB nearest neighbor queries.
 constexpr bool DEFAULT_EXCLUDE_II(false); //!< Default for whether or not to include self-neighbors.
+constexpr bool DEFAULT_HALF_LIST(false);  //!< Default for whether or not to find only bonds with i < j.
 constexpr auto ITERATOR_TERMINATOR
     = NeighborBond(-1, -1, 0); //!< The object returned when iteration is complete.
 
+//! Whether a point is excluded from the neighbors of a query point by index.
+/*! \param query_point_idx The index of the query point.
+ *  \param point_idx The index of the candidate neighbor point.
+ *  \param exclude_ii Whether to exclude points with the same index.
+ *  \param half_list Whether to exclude points with smaller or equal indices. Queries
+ *         only allow this when the query points are the points (see
+ *         NeighborQuery::validateHalfList).
+ */
+inline bool excludeNeighborIndex(unsigned int query_point_idx, unsigned int point_idx, bool exclude_ii,
+                                 bool half_list)
+{
+    return half_list ? point_idx <= query_point_idx : (exclude_ii && point_idx == query_point_idx);
+}
+
 //! POD class to hold information about generic queries.
 /*! This class provides a standard method for specifying the type of query to
  *  perform with a NeighborQuery object. Rather than calling queryBall
@@ -60,6 +77,10 @@ struct QueryArgs
     float scale {DEFAULT_SCALE};          //! The scale factor to use when performing repeated ball queries
                                           //! to find a specified number of nearest neighbors.
     bool exclude_ii {DEFAULT_EXCLUDE_II}; //! If true, exclude self-neighbors.
+    bool half_list {DEFAULT_HALF_LIST};   //! If true, only find bonds whose point index is greater than
+                                          //! the query point index. This may only be used when the
+                                          //! query points are the points, in which case each pair of
+                                          //! neighbors is found exactly once.
 };
 
 // Forward declare the iterators
@@ -81,25 +102,9 @@ public:
 
     //! Constructor
     NeighborQuery(box::Box box, const vec3<float>* points, unsigned int n_points)
-        : m_box(std::move(box)), m_points(points), m_n_points(n_points)
+        : m_box(std::move(box))
     {
-        // Reject systems with 0 particles
-        if (m_n_points == 0)
-        {
-            throw std::invalid_argument("Cannot create a NeighborQuery with 0 particles.");
-        }
-
-        // For 2D systems, check if any z-coordinates are outside some tolerance of z=0
-        if (m_box.is2D())
-        {
-            for (unsigned int i(0); i < n_points; i++)
-            {
-                if (std::abs(m_points[i].z) > 1e-6)
-                {
-                    throw std::invalid_argument("A point with z != 0 was provided in a 2D box.");
-                }
-            }
-        }
+        setPoints(points, n_points);
     }
 
     //! Empty Destructor
@@ -120,17 +125,33 @@ public:
     virtual std::shared_ptr<NeighborQueryIterator>
     query(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs query_args) const
     {
-        // pair calculations using non-periodic boxes should fail
-        vec3<bool> periodic = m_box.getPeriodic();
-        if (!(periodic.x && periodic.y && periodic.z))
-        {
-            throw std::domain_error("Pair queries in a non-periodic box are not implemented.");
-        }
-
+        validatePeriodic();
         this->validateQueryArgs(query_args);
+        validateHalfList(query_points, n_query_points, query_args);
         return std::make_shared<NeighborQueryIterator>(this, query_points, n_query_points, query_args);
     }
 
+    //! Apply a function to every neighbor bond found by a query.
+    /*! This is the visitor counterpart to query. Rather than generating
+     *  iterators, the provided function is called once for every
+     *  NeighborBond found. This generic implementation is built on the
+     *  per-point iterators returned by querySingle. Subclasses that can
+     *  traverse their data structures directly (AABBQuery and LinkCell)
+     *  shadow this method with implementations that perform no heap
+     *  allocation or virtual dispatch per point. Since member templates
+     *  cannot be virtual, code holding a pointer to the base class should
+     *  use loopOverNeighbors, which dispatches to the concrete type.
+     *
+     *  \param query_points The points to find neighbors for.
+     *  \param n_query_points The number of query points.
+     *  \param qargs The query arguments that should be used to find neighbors.
+     *  \param visit An object with operator(const NeighborBond&).
+     *  \param parallel If true, query points are processed in parallel.
+     */
+    template<typename Visitor>
+    void forEachNeighbor(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                         const Visitor& visit, bool parallel = true) const;
+
     //! Perform a per-particle query based on a set of query parameters.
     /*! This function is the primary interface by which subclasses provide
      *  logic for finding neighbors. All such logic should be contained in
@@ -175,6 +196,57 @@ public:
     }
 
 protected:
+    //! Validate and store the points used to find neighbors.
+    void setPoints(const vec3<float>* points, unsigned int n_points)
+    {
+        // Reject systems with 0 particles
+        if (n_points == 0)
+        {
+            throw std::invalid_argument("Cannot create a NeighborQuery with 0 particles.");
+        }
+
+        // For 2D systems, check if any z-coordinates are outside some tolerance of z=0
+        if (m_box.is2D())
+        {
+            for (unsigned int i(0); i < n_points; i++)
+            {
+                if (std::abs(points[i].z) > 1e-6)
+                {
+                    throw std::invalid_argument("A point with z != 0 was provided in a 2D box.");
+                }
+            }
+        }
+
+        m_points = points;
+        m_n_points = n_points;
+    }
+
+    //! Raise an error if pair queries are not supported in the box.
+    void validatePeriodic() const
+    {
+        // pair calculations using non-periodic boxes should fail
+        vec3<bool> periodic = m_box.getPeriodic();
+        if (!(periodic.x && periodic.y && periodic.z))
+        {
+            throw std::domain_error("Pair queries in a non-periodic box are not implemented.");
+        }
+    }
+
+    //! Raise an error if a half list is requested for points other than the reference points.
+    /*! A half list drops the bonds whose point index is not greater than the
+     *  query point index, which only finds every pair once if the indices of
+     *  the query points and of the points refer to the same points.
+     */
+    void validateHalfList(const vec3<float>* query_points, unsigned int n_query_points,
+                          const QueryArgs& args) const
+    {
+        if (args.half_list && (query_points != m_points || n_query_points != m_n_points))
+        {
+            throw std::runtime_error("Half neighbor lists can only be found when the query points are the "
+                                     "points of the NeighborQuery.");
+        }
+    }
+
     //! Validate the combination of specified arguments.
     /*! Before checking if the combination of parameters currently set is
      *  valid, this function first attempts to infer a mode if one is not set in
@@ -198,6 +270,11 @@ protected:
                 throw std::runtime_error(
                     "You cannot set num_neighbors in the query arguments when performing ball queries.");
             }
+            // A half list never contains bonds between equal indices.
+            if (args.half_list)
+            {
+                args.exclude_ii = true;
+            }
         }
         else if (args.mode == QueryType::nearest)
         {
@@ -210,6 +287,11 @@ protected:
             {
                 args.r_max = std::numeric_limits<float>::infinity();
             }
+            if (args.half_list)
+            {
+                throw std::runtime_error("Half neighbor lists are only supported for ball queries, because "
+                                         "nearest neighbor relations are not symmetric.");
+            }
         }
         else
         {
@@ -261,10 +343,11 @@ public:
 
     //! Constructor
     NeighborQueryPerPointIterator(const NeighborQuery* neighbor_query, const vec3<float>& query_point,
-                                  unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii)
+                                  unsigned int query_point_idx, float r_max, float r_min, bool exclude_ii,
+                                  bool half_list = false)
         : NeighborPerPointIterator(query_point_idx), m_neighbor_query(neighbor_query),
           m_query_point(query_point), m_finished(false), m_r_max(r_max), m_r_min(r_min),
-          m_exclude_ii(exclude_ii)
+          m_exclude_ii(exclude_ii), m_half_list(half_list)
     {}
 
     //! Empty Destructor
@@ -286,6 +369,13 @@ protected:
     float m_r_max;   //!< Cutoff distance for neighbors.
     float m_r_min;   //!< Minimum distance for neighbors.
     bool m_exclude_ii; //!< Flag to indicate whether or not to include self bonds.
+    bool m_half_list;  //!< Flag to indicate whether to only find points with larger indices.
+
+    //! Whether a point is excluded from the neighbors of the query point by its index.
+    bool excludeIndex(unsigned int point_idx) const
+    {
+        return excludeNeighborIndex(m_query_point_idx, point_idx, m_exclude_ii, m_half_list);
+    }
 };
 
 //! The iterator class for neighbor queries on NeighborQuery objects.
@@ -359,11 +449,16 @@ public:
 
     //! Generate a NeighborList from query.
     /*! This function exploits parallelism by finding the neighbors for
-     *  each query point in parallel and adding them to a list, which is
-     *  then sorted in parallel as well before being added to the
-     *  NeighborList object. Right now this won't be backwards compatible
-     *  because the kn query is not symmetric, so even if we reverse the
-     *  output order here the actual neighbors found will be different.
+     *  contiguous ranges of query points in parallel. Since each range's
+     *  bonds are already grouped by query point, no global sort is needed:
+     *  the number of neighbors of each query point is recorded during the
+     *  search, the counts are prefix-summed into the offsets of each query
+     *  point's bonds, and each range's bonds are then written directly into
+     *  their final location in the NeighborList. Only the bonds of each
+     *  query point are sorted, by point index or by distance. Right now this
+     *  won't be backwards compatible because the kn query is not symmetric,
+     *  so even if we reverse the output order here the actual neighbors found
+     *  will be different.
      *
      *  This function returns a pointer, not a shared pointer, so the
      *  caller is responsible for deleting it. The reason for this is that
@@ -372,13 +467,25 @@ public:
      */
     NeighborList* toNeighborList(bool sort_by_distance = false)
     {
-        using BondVector = tbb::enumerable_thread_specific<std::vector<NeighborBond>>;
-        BondVector bonds;
+        //! The bonds found for a contiguous range of query points.
+        struct BondRange
+        {
+            size_t begin;                    //!< The first query point of the range.
+            size_t end;                      //!< One past the last query point of the range.
+            std::vector<NeighborBond> bonds; //!< The bonds of the range, grouped by query point.
+        };
+        using BondRanges = tbb::enumerable_thread_specific<std::vector<BondRange>>;
+
+        BondRanges ranges;
+        std::vector<unsigned int> counts(m_num_query_points);
         util::forLoopWrapper(0, m_num_query_points, [&](size_t begin, size_t end) {
-            BondVector::reference local_bonds(bonds.local());
+            BondRanges::reference local_ranges(ranges.local());
+            local_ranges.push_back({begin, end, {}});
+            std::vector<NeighborBond>& range_bonds = local_ranges.back().bonds;
             NeighborBond nb;
             for (size_t i = begin; i < end; ++i)
             {
+                const size_t num_range_bonds = range_bonds.size();
                 std::shared_ptr<NeighborQueryPerPointIterator> it = this->query(i);
                 while (!it->end())
                 {
@@ -386,37 +493,66 @@ public:
                     // If we're excluding ii bonds, we have to check before adding.
                     if (nb != ITERATOR_TERMINATOR)
                     {
-                        local_bonds.emplace_back(nb.query_point_idx, nb.point_idx, nb.distance);
+                        range_bonds.emplace_back(nb.query_point_idx, nb.point_idx, nb.distance);
                     }
                 }
+                counts[i] = range_bonds.size() - num_range_bonds;
             }
         });
 
-        tbb::flattened2d<BondVector> flat_bonds = tbb::flatten2d(bonds);
-        std::vector<NeighborBond> linear_bonds(flat_bonds.begin(), flat_bonds.end());
-        if (sort_by_distance)
-        {
-            tbb::parallel_sort(linear_bonds.begin(), linear_bonds.end(), compareNeighborDistance);
-        }
-        else
-        {
-            tbb::parallel_sort(linear_bonds.begin(), linear_bonds.end(), compareNeighborBond);
-        }
-
-        unsigned int num_bonds = linear_bonds.size();
+        // Convert the counts into the offset of each query point's first bond.
+        std::vector<unsigned int> offsets(m_num_query_points + 1, 0);
+        std::partial_sum(counts.begin(), counts.end(), offsets.begin() + 1);
+        const unsigned int num_bonds = offsets[m_num_query_points];
 
         auto* nl = new NeighborList();
         nl->setNumBonds(num_bonds, m_num_query_points, m_neighbor_query->getNPoints());
+        nl->setHalfList(m_qargs.half_list);
 
-        util::forLoopWrapper(0, num_bonds, [&](size_t begin, size_t end) {
-            for (size_t bond = begin; bond < end; ++bond)
+        std::vector<BondRange*> all_ranges;
+        for (auto& local_ranges : ranges)
+        {
+            for (auto& range : local_ranges)
             {
-                nl->getNeighbors()(bond, 0) = linear_bonds[bond].query_point_idx;
-                nl->getNeighbors()(bond, 1) = linear_bonds[bond].point_idx;
-                nl->getDistances()[bond] = linear_bonds[bond].distance;
-                nl->getWeights()[bond] = float(1.0);
+                all_ranges.push_back(&range);
+            }
+        }
+
+        util::forLoopWrapper(0, all_ranges.size(), [&](size_t begin, size_t end) {
+            for (size_t r = begin; r < end; ++r)
+            {
+                std::vector<NeighborBond>& range_bonds = all_ranges[r]->bonds;
+                const unsigned int range_offset = offsets[all_ranges[r]->begin];
+
+                // Sort the bonds of each query point in the range.
+                for (size_t i = all_ranges[r]->begin; i < all_ranges[r]->end; ++i)
+                {
+                    auto segment_begin = range_bonds.begin() + (offsets[i] - range_offset);
+                    auto segment_end = segment_begin + counts[i];
+                    if (sort_by_distance)
+                    {
+                        std::sort(segment_begin, segment_end, compareNeighborDistance);
+                    }
+                    else
+                    {
+                        std::sort(segment_begin, segment_end, compareNeighborBond);
+                    }
+                }
+
+                for (size_t j = 0; j < range_bonds.size(); ++j)
+                {
+                    const size_t bond = range_offset + j;
+                    nl->getNeighbors()(bond, 0) = range_bonds[j].query_point_idx;
+                    nl->getNeighbors()(bond, 1) = range_bonds[j].point_idx;
+                    nl->getDistances()[bond] = range_bonds[j].distance;
+                    nl->getWeights()[bond] = float(1.0);
+                }
+
+                // Release each range's memory as soon as it has been copied.
+                std::vector<NeighborBond>().swap(range_bonds);
             }
         });
+        nl->updateOffsets();
 
         return nl;
     }
@@ -432,6 +568,30 @@ protected:
     unsigned int m_cur_p; //!< The current particle under consideration.
 };
 
+template<typename Visitor>
+void NeighborQuery::forEachNeighbor(const vec3<float>* query_points, unsigned int n_query_points,
+                                    QueryArgs qargs, const Visitor& visit, bool parallel) const
+{
+    std::shared_ptr<NeighborQueryIterator> iter = this->query(query_points, n_query_points, qargs);
+
+    util::forLoopWrapper(
+        0, n_query_points,
+        [&iter, &visit](size_t begin, size_t end) {
+            NeighborBond nb;
+            for (size_t i = begin; i != end; ++i)
+            {
+                std::shared_ptr<NeighborQueryPerPointIterator> it = iter->query(i);
+                nb = it->next();
+                while (!it->end())
+                {
+                    visit(nb);
+                    nb = it->next();
+                }
+            }
+        },
+        parallel);
+}
+
 }; }; // end namespace freud::locality
 
 #endif // NEIGHBOR_QUERY_H
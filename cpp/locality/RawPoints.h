@@ -54,9 +54,25 @@ public:
         }
 
         this->validateQueryArgs(query_args);
+        validateHalfList(query_points, n_query_points, query_args);
         return std::make_shared<NeighborQueryIterator>(this, query_points, n_query_points, query_args);
     }
 
+    //! Perform a visitor query using the underlying AABBQuery (see NeighborQuery.h for documentation).
+    template<typename Visitor>
+    void forEachNeighbor(const vec3<float>* query_points, unsigned int n_query_points, QueryArgs qargs,
+                         const Visitor& visit, bool parallel = true) const
+    {
+        if (!aq)
+        {
+            aq = std::make_unique<AABBQuery>(m_box, m_points, m_n_points);
+        }
+
+        this->validateQueryArgs(qargs);
+        validateHalfList(query_points, n_query_points, qargs);
+        aq->visitNeighbors(query_points, n_query_points, qargs, visit, parallel);
+    }
+
     // dummy implementation for pure virtual function in the parent class
     std::shared_ptr<NeighborQueryPerPointIterator>
     querySingle(const vec3<float> query_point, unsigned int query_point_idx, QueryArgs qargs) const override
@@ -0,0 +1,121 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
+
+#include "VerletList.h"
+#include "utils.h"
+
+/*! \file VerletList.cc
+    \brief Reuses a buffered neighbor list across trajectory frames.
+*/
+
+namespace freud { namespace locality {
+
+VerletList::VerletList(float r_max, float skin, float r_min, bool exclude_ii)
+    : m_r_max(r_max), m_skin(skin), m_r_min(r_min), m_exclude_ii(exclude_ii),
+      m_neighbor_list(std::make_shared<NeighborList>())
+{
+    if (r_max <= 0)
+    {
+        throw std::invalid_argument("VerletList requires r_max to be positive.");
+    }
+    if (skin < 0)
+    {
+        throw std::invalid_argument("VerletList requires skin to be non-negative.");
+    }
+    if (r_min < 0 || r_min >= r_max)
+    {
+        throw std::invalid_argument("VerletList requires 0 <= r_min < r_max.");
+    }
+}
+
+float VerletList::maxDisplacement(const vec3<float>* positions,
+                                  const std::vector<vec3<float>>& reference) const
+{
+    tbb::enumerable_thread_specific<float> local_max_sq(0);
+    util::forLoopWrapper(0, reference.size(), [&](size_t begin, size_t end) {
+        float& max_sq = local_max_sq.local();
+        for (size_t i = begin; i < end; ++i)
+        {
+            const vec3<float> delta = m_box.wrap(positions[i] - reference[i]);
+            max_sq = std::max(max_sq, dot(delta, delta));
+        }
+    });
+    float max_sq = 0;
+    for (const auto& value : local_max_sq)
+    {
+        max_sq = std::max(max_sq, value);
+    }
+    return std::sqrt(max_sq);
+}
+
+bool VerletList::needsRebuild(const NeighborQuery* nq, const vec3<float>* query_points,
+                              unsigned int n_query_points) const
+{
+    if (m_num_builds == 0 || nq->getBox() != m_box || nq->getNPoints() != m_build_points.size()
+        || n_query_points != m_build_query_points.size())
+    {
+        return true;
+    }
+
+    // Every bond shorter than r_max is still in the buffered list as long as
+    // the combined displacement of both ends cannot have consumed the skin.
+    const float point_displacement = maxDisplacement(nq->getPoints(), m_build_points);
+    if (point_displacement > m_skin)
+    {
+        return true;
+    }
+    const float query_point_displacement = (query_points == nq->getPoints())
+        ? point_displacement
+        : maxDisplacement(query_points, m_build_query_points);
+    return point_displacement + query_point_displacement > m_skin;
+}
+
+void VerletList::compute(const NeighborQuery* nq, const vec3<float>* query_points,
+                         unsigned int n_query_points)
+{
+    m_rebuilt = needsRebuild(nq, query_points, n_query_points);
+    if (m_rebuilt)
+    {
+        m_box = nq->getBox();
+        m_build_points.assign(nq->getPoints(), nq->getPoints() + nq->getNPoints());
+        m_build_query_points.assign(query_points, query_points + n_query_points);
+
+        // Bonds may shrink below r_min before the next build, so the
+        // buffered list also covers distances down to r_min - skin.
+        QueryArgs qargs;
+        qargs.mode = QueryType::ball;
+        qargs.r_max = m_r_max + m_skin;
+        qargs.r_min = std::max(m_r_min - m_skin, 0.0F);
+        qargs.exclude_ii = m_exclude_ii;
+        std::unique_ptr<NeighborList> nlist(nq->query(query_points, n_query_points, qargs)->toNeighborList());
+        m_skin_list = *nlist;
+        ++m_num_builds;
+    }
+    else
+    {
+        // Update the distances of the buffered bonds in place.
+        const vec3<float>* points = nq->getPoints();
+        const auto& neighbors = m_skin_list.getNeighbors();
+        auto& distances = m_skin_list.getDistances();
+        util::forLoopWrapper(0, m_skin_list.getNumBonds(), [&](size_t begin, size_t end) {
+            for (size_t bond = begin; bond < end; ++bond)
+            {
+                const vec3<float> delta
+                    = m_box.wrap(points[neighbors(bond, 1)] - query_points[neighbors(bond, 0)]);
+                distances[bond] = std::sqrt(dot(delta, delta));
+            }
+        });
+    }
+
+    // The output list shares the buffered arrays until filtering replaces
+    // them, so the buffered list itself is never modified here.
+    *m_neighbor_list = m_skin_list;
+    m_neighbor_list->filter_r(m_r_max, m_r_min);
+}
+
+}; }; // end namespace freud::locality
@@ -0,0 +1,120 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef VERLET_LIST_H
+#define VERLET_LIST_H
+
+#include <memory>
+#include <vector>
+
+#include "Box.h"
+#include "NeighborList.h"
+#include "NeighborQuery.h"
+#include "VectorMath.h"
+
+/*! \file VerletList.h
+    \brief Reuses a buffered neighbor list across trajectory frames.
+*/
+
+namespace freud { namespace locality {
+
+//! Neighbor list that is reused across frames until points move too far
+/*! The first call to compute builds a "skin" list containing all bonds with
+    distances less than r_max + skin. On later frames, the distances of the
+    buffered bonds are recomputed from the new positions and the list is
+    filtered down to r_max, which is much cheaper than a new neighbor query.
+
+    The buffered list is guaranteed to contain every bond shorter than r_max
+    as long as the largest displacement of any point plus the largest
+    displacement of any query point since the last build does not exceed the
+    skin. For self-neighbor lists this is the usual criterion that no particle
+    moves farther than skin / 2. The list is rebuilt whenever this criterion is
+    violated or the box or number of points changes.
+*/
+class VerletList
+{
+public:
+    //! Constructor
+    /*! \param r_max Cutoff distance of the output neighbor list.
+        \param skin Extra buffer distance added to r_max when building.
+        \param r_min Minimum distance of the output neighbor list.
+        \param exclude_ii Whether to exclude bonds between points with equal indices.
+    */
+    VerletList(float r_max, float skin, float r_min = 0, bool exclude_ii = false);
+
+    //! Compute the neighbor list for the current frame
+    void compute(const NeighborQuery* nq, const vec3<float>* query_points, unsigned int n_query_points);
+
+    //! Force a rebuild of the neighbor list on the next call to compute
+    void reset()
+    {
+        m_num_builds = 0;
+    }
+
+    //! Get the neighbor list of the last frame
+    std::shared_ptr<NeighborList> getNeighborList() const
+    {
+        return m_neighbor_list;
+    }
+
+    //! Get the cutoff distance
+    float getRMax() const
+    {
+        return m_r_max;
+    }
+
+    //! Get the skin distance
+    float getSkin() const
+    {
+        return m_skin;
+    }
+
+    //! Get the minimum distance
+    float getRMin() const
+    {
+        return m_r_min;
+    }
+
+    //! Get whether bonds between points with equal indices are excluded
+    bool getExcludeII() const
+    {
+        return m_exclude_ii;
+    }
+
+    //! Return whether the last call to compute rebuilt the buffered list
+    bool getRebuilt() const
+    {
+        return m_rebuilt;
+    }
+
+    //! Return the number of times the buffered list has been built
+    unsigned int getNumBuilds() const
+    {
+        return m_num_builds;
+    }
+
+private:
+    //! Check whether the buffered list is still valid for the given frame
+    bool needsRebuild(const NeighborQuery* nq, const vec3<float>* query_points,
+                      unsigned int n_query_points) const;
+
+    //! Largest displacement between two sets of positions in the box
+    float maxDisplacement(const vec3<float>* positions, const std::vector<vec3<float>>& reference) const;
+
+    float m_r_max;     //!< Cutoff distance of the output neighbor list
+    float m_skin;      //!< Buffer distance of the buffered neighbor list
+    float m_r_min;     //!< Minimum distance of the output neighbor list
+    bool m_exclude_ii; //!< Whether to exclude bonds between equal indices
+
+    box::Box m_box;                                  //!< Box at the time of the last build
+    std::vector<vec3<float>> m_build_points;         //!< Points at the time of the last build
+    std::vector<vec3<float>> m_build_query_points;   //!< Query points at the time of the last build
+    NeighborList m_skin_list;                        //!< Bonds shorter than r_max + skin at the last build
+    std::shared_ptr<NeighborList> m_neighbor_list;   //!< Neighbor list of the last frame
+    bool m_rebuilt {false};                          //!< Whether the last compute rebuilt the list
+    unsigned int m_num_builds {0};                   //!< Number of builds since construction or reset
+};
+
+}; }; // end namespace freud::locality
+
+#endif // VERLET_LIST_H
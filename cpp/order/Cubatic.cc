@@ -1,13 +1,14 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
-#include <cstring>
-#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <stdexcept>
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
 
 #include "Cubatic.h"
+#include "Eigen/Eigen/Dense"
 #include "utils.h"
 
 /*! \file Cubatic.h
@@ -71,6 +72,31 @@ tensor4 tensor4::operator*(const float& b) const
     return c;
 }
 
+float tensor4::contract(const vec3<float>& vector) const
+{
+    const std::array<float, 3> v = {vector.x, vector.y, vector.z};
+    std::array<float, 9> outer;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            outer[3 * i + j] = v[i] * v[j];
+        }
+    }
+
+    float result = 0;
+    for (unsigned int ij = 0; ij < 9; ++ij)
+    {
+        float row = 0;
+        for (unsigned int kl = 0; kl < 9; ++kl)
+        {
+            row += data[9 * ij + kl] * outer[kl];
+        }
+        result += outer[ij] * row;
+    }
+    return result;
+}
+
 void tensor4::copyToManagedArray(util::ManagedArray<float>& ma)
 {
     std::copy(data.begin(), data.end(), ma.get());
@@ -158,10 +184,143 @@ Cubatic::Cubatic(float t_initial, float t_final, float scale, unsigned int n_rep
     m_system_vectors[2] = vec3<float>(0, 0, 1);
 }
 
-tensor4 Cubatic::calcCubaticTensor(quat<float>& orientation)
+namespace {
+
+//! Index of the moment x^a y^b z^c with a + b + c = 4, stored at 5 * b + c.
+inline unsigned int momentIndex(unsigned int i, unsigned int j, unsigned int k, unsigned int l)
+{
+    const std::array<unsigned int, 4> indices = {i, j, k, l};
+    unsigned int b = 0;
+    unsigned int c = 0;
+    for (unsigned int index : indices)
+    {
+        b += static_cast<unsigned int>(index == 1);
+        c += static_cast<unsigned int>(index == 2);
+    }
+    return 5 * b + c;
+}
+
+//! Sum of G(u, u, u, u) over the columns u of a rotation matrix.
+/*! The derivatives are taken with respect to rotations exp([w]_x) R. With
+ *  M = G(u, u, ., .) and g = M u for each column u, the gradient is the sum
+ *  of 4 u x g and the Hessian is the sum of
+ *  12 [u]_x^T M [u]_x + 2 (g u^T + u g^T) - 4 (g . u) I.
+ *
+ *  \param global_tensor The global tensor G in double precision.
+ *  \param rotation The rotation matrix R.
+ *  \param gradient Output for the gradient.
+ *  \param hessian Output for the Hessian.
+ */
+double alignment(const std::array<double, 81>& global_tensor, const Eigen::Matrix3d& rotation,
+                 Eigen::Vector3d& gradient, Eigen::Matrix3d& hessian)
+{
+    double value = 0;
+    gradient.setZero();
+    hessian.setZero();
+    for (unsigned int a = 0; a < 3; ++a)
+    {
+        const Eigen::Vector3d u = rotation.col(a);
+        Eigen::Matrix3d m = Eigen::Matrix3d::Zero();
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                const double uu = u[i] * u[j];
+                for (unsigned int k = 0; k < 3; ++k)
+                {
+                    for (unsigned int l = 0; l < 3; ++l)
+                    {
+                        m(k, l) += global_tensor[27 * i + 9 * j + 3 * k + l] * uu;
+                    }
+                }
+            }
+        }
+        const Eigen::Vector3d g = m * u;
+        const double gu = g.dot(u);
+        Eigen::Matrix3d skew;
+        skew << 0, -u[2], u[1], u[2], 0, -u[0], -u[1], u[0], 0;
+
+        value += gu;
+        gradient += 4 * u.cross(g);
+        hessian += 12 * skew.transpose() * m * skew + 2 * (g * u.transpose() + u * g.transpose())
+            - 4 * gu * Eigen::Matrix3d::Identity();
+    }
+    return value;
+}
+
+//! Maximize the alignment with Newton's method on the rotation group.
+/*! Each step solves the Newton equations with the Hessian shifted to be
+ *  negative definite, so steps always point uphill, and the step length is
+ *  halved until the alignment increases.
+ *
+ *  \param global_tensor The global tensor G in double precision.
+ *  \param rotation The initial rotation, replaced by the local maximum.
+ *
+ *  \return The maximal alignment.
+ */
+double maximizeAlignment(const std::array<double, 81>& global_tensor, Eigen::Matrix3d& rotation)
+{
+    constexpr unsigned int max_iterations = 100;
+    constexpr double max_step = 0.5;
+
+    Eigen::Vector3d gradient;
+    Eigen::Matrix3d hessian;
+    double value = alignment(global_tensor, rotation, gradient, hessian);
+    for (unsigned int iteration = 0; iteration < max_iterations; ++iteration)
+    {
+        if (gradient.norm() <= 1e-12 * std::max(1.0, std::abs(value)))
+        {
+            break;
+        }
+
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(hessian);
+        const Eigen::Vector3d& eigenvalues = solver.eigenvalues();
+        const double shift = std::max(0.0, eigenvalues[2])
+            + 1e-6 * std::max(eigenvalues.cwiseAbs().maxCoeff(), 1e-12);
+        Eigen::Vector3d step = Eigen::Vector3d::Zero();
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            const Eigen::Vector3d axis = solver.eigenvectors().col(k);
+            step -= axis * (axis.dot(gradient) / (eigenvalues[k] - shift));
+        }
+        if (step.norm() > max_step)
+        {
+            step *= max_step / step.norm();
+        }
+
+        bool improved = false;
+        Eigen::Matrix3d trial_rotation;
+        Eigen::Vector3d trial_gradient;
+        Eigen::Matrix3d trial_hessian;
+        for (unsigned int halving = 0; halving < 30; ++halving)
+        {
+            trial_rotation = Eigen::AngleAxisd(step.norm(), step.normalized()).toRotationMatrix() * rotation;
+            const double trial_value = alignment(global_tensor, trial_rotation, trial_gradient, trial_hessian);
+            if (trial_value > value)
+            {
+                improved = true;
+                value = trial_value;
+                break;
+            }
+            step *= 0.5;
+        }
+        if (!improved)
+        {
+            break;
+        }
+        rotation = trial_rotation;
+        gradient = trial_gradient;
+        hessian = trial_hessian;
+    }
+    return value;
+}
+
+} // end anonymous namespace
+
+tensor4 Cubatic::calcCubaticTensor(const quat<float>& orientation) const
 {
     tensor4 calculated_tensor = tensor4();
-    for (auto& m_system_vector : m_system_vectors)
+    for (const auto& m_system_vector : m_system_vectors)
     {
         calculated_tensor += tensor4(rotate(orientation, m_system_vector));
     }
@@ -174,184 +333,181 @@ float Cubatic::calcCubaticOrderParameter(const tensor4& cubatic_tensor, const te
     return float(1.0) - dot(diff, diff) / dot(cubatic_tensor, cubatic_tensor);
 }
 
-template<typename T> quat<float> Cubatic::calcRandomQuaternion(T& dist, float angle_multiplier) const
-{
-    float theta = 2.0 * M_PI * dist();
-    float phi = std::acos(2.0 * dist() - 1.0);
-    vec3<float> axis
-        = vec3<float>(std::cos(theta) * std::sin(phi), std::sin(theta) * std::sin(phi), std::cos(phi));
-    float axis_norm = std::sqrt(dot(axis, axis));
-    axis /= axis_norm;
-    float angle = angle_multiplier * dist();
-    return quat<float>::fromAxisAngle(axis, angle);
-}
-
-util::ManagedArray<tensor4> Cubatic::calculatePerParticleTensor(const quat<float>* orientations) const
+tensor4 Cubatic::calculateGlobalTensor(const quat<float>* orientations) const
 {
-    util::ManagedArray<tensor4> particle_tensor(m_n);
-
-    // calculate per-particle tensor
-    util::forLoopWrapper(0, m_n, [=, &particle_tensor](size_t begin, size_t end) {
+    // Sum the moments x^a y^b z^c with a + b + c = 4 of the rotated basis
+    // vectors of all particles.
+    using Moments = std::array<double, 25>;
+    tbb::enumerable_thread_specific<Moments> local_moments(Moments {});
+    util::forLoopWrapper(0, m_n, [&](size_t begin, size_t end) {
+        Moments& moments = local_moments.local();
         for (size_t i = begin; i < end; ++i)
         {
-            tensor4 l_mbar = tensor4();
             for (const auto& m_system_vector : m_system_vectors)
             {
-                // Calculate the homogeneous tensor H for each vector then add
-                // to the per-particle value.
-                vec3<float> v_r = rotate(orientations[i], m_system_vector);
-                tensor4 r4_tensor(v_r);
-                l_mbar += r4_tensor;
+                const vec3<float> v_r = rotate(orientations[i], m_system_vector);
+                std::array<double, 5> x_powers = {1, v_r.x};
+                std::array<double, 5> y_powers = {1, v_r.y};
+                std::array<double, 5> z_powers = {1, v_r.z};
+                for (unsigned int p = 2; p < 5; ++p)
+                {
+                    x_powers[p] = x_powers[p - 1] * v_r.x;
+                    y_powers[p] = y_powers[p - 1] * v_r.y;
+                    z_powers[p] = z_powers[p - 1] * v_r.z;
+                }
+                for (unsigned int b = 0; b < 5; ++b)
+                {
+                    for (unsigned int c = 0; b + c < 5; ++c)
+                    {
+                        moments[5 * b + c] += x_powers[4 - b - c] * y_powers[b] * z_powers[c];
+                    }
+                }
             }
-
-            // Apply the prefactor from the sum in equation 27 before assigning.
-            particle_tensor[i] = l_mbar * 2.0;
         }
     });
-    return particle_tensor;
-}
+    Moments moments {};
+    for (const auto& local : local_moments)
+    {
+        for (unsigned int m = 0; m < 25; ++m)
+        {
+            moments[m] += local[m];
+        }
+    }
 
-tensor4 Cubatic::calculateGlobalTensor(quat<float>* orientations) const
-{
+    // Note that in the third equation in eq. 27, the prefactor of the sum is
+    // 2/N, where the factor of 2 comes from the sum in the first equation.
+    const double prefactor = 2.0 / static_cast<double>(m_n);
     tensor4 global_tensor = tensor4();
-    util::ManagedArray<tensor4> particle_tensor = calculatePerParticleTensor(orientations);
-
-    // now calculate the global tensor
-    float n_inv = float(1.0) / static_cast<float>(m_n);
-
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, 81),
-                      [=, &global_tensor, &n_inv, &particle_tensor](const tbb::blocked_range<size_t>& r) {
-                          for (size_t i = r.begin(); i != r.end(); i++)
-                          {
-                              float tensor_value = 0;
-                              for (unsigned int j = 0; j < m_n; j++)
-                              {
-                                  tensor_value += particle_tensor[j][i];
-                              }
-                              // Note that in the third equation in eq. 27, the prefactor of the
-                              // sum is 2/N, but the factor of 2 is already accounted for in the
-                              // calculation of per particle calculation in
-                              // calculatePerParticleTensor, so here we just need to apply the
-                              // 1/N scaling.
-                              global_tensor[i] = tensor_value * n_inv;
-                          }
-                      });
+    unsigned int cnt = 0;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                for (unsigned int l = 0; l < 3; ++l)
+                {
+                    global_tensor[cnt] = static_cast<float>(prefactor * moments[momentIndex(i, j, k, l)]);
+                    ++cnt;
+                }
+            }
+        }
+    }
     return global_tensor - m_gen_r4_tensor;
 }
 
-void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
+quat<float> Cubatic::calcCubaticOrientation(const tensor4& global_tensor)
 {
-    m_n = num_orientations;
-    m_particle_order_parameter.prepare(m_n);
-
-    // Calculate the per-particle tensor
-    tensor4 global_tensor = calculateGlobalTensor(orientations);
-    m_global_tensor.prepare({3, 3, 3, 3});
-    global_tensor.copyToManagedArray(m_global_tensor);
-
-    // The paper recommends using a Newton-Raphson scheme to optimize the order
-    // parameter, but in practice we find that simulated annealing performs
-    // much better, so we perform replicates of the process and choose the best
-    // one.
-    util::ManagedArray<tensor4> p_cubatic_tensor(m_n_replicates);
-    util::ManagedArray<float> p_cubatic_order_parameter(m_n_replicates);
-    util::ManagedArray<quat<float>> p_cubatic_orientation(m_n_replicates);
-
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, m_n_replicates),
-        [=, &p_cubatic_orientation, &p_cubatic_order_parameter,
-         &p_cubatic_tensor](const tbb::blocked_range<size_t>& r) {
-            // create thread-specific rng
-            unsigned int thread_start = r.begin();
-
-            std::vector<unsigned int> seed_seq(3);
-            seed_seq[0] = m_seed;
-            seed_seq[1] = thread_start;
-            seed_seq[2] = 0xffaabb;
-            std::seed_seq seed(seed_seq.begin(), seed_seq.end());
-            std::mt19937 rng(seed);
-            std::uniform_real_distribution<float> base_dist(0, 1);
-            auto dist = [&]() { return base_dist(rng); };
-
-            for (size_t i = r.begin(); i != r.end(); i++)
+    std::array<double, 81> tensor;
+    std::copy(global_tensor.data.begin(), global_tensor.data.end(), tensor.begin());
+
+    // Acting on symmetric matrices, the global tensor of perfectly aligned
+    // cubes has its largest eigenvalue on the two-dimensional space of
+    // traceless matrices that are diagonal in the cubatic frame. The tensor is
+    // written as a 6x6 matrix in an orthonormal basis of symmetric matrices.
+    std::array<Eigen::Matrix3d, 6> basis;
+    for (unsigned int alpha = 0; alpha < 3; ++alpha)
+    {
+        basis[alpha] = Eigen::Matrix3d::Zero();
+        basis[alpha](alpha, alpha) = 1;
+        const unsigned int i = (alpha == 2) ? 1 : 0;
+        const unsigned int j = (alpha == 0) ? 1 : 2;
+        basis[3 + alpha] = Eigen::Matrix3d::Zero();
+        basis[3 + alpha](i, j) = basis[3 + alpha](j, i) = M_SQRT1_2;
+    }
+    Eigen::Matrix<double, 6, 6> unfolded;
+    for (unsigned int alpha = 0; alpha < 6; ++alpha)
+    {
+        for (unsigned int beta = 0; beta < 6; ++beta)
+        {
+            double value = 0;
+            for (unsigned int ij = 0; ij < 9; ++ij)
             {
-                // need to generate random orientation
-                quat<float> cubatic_orientation = calcRandomQuaternion(dist);
-                quat<float> new_orientation = cubatic_orientation;
-
-                // now calculate the cubatic tensor
-                tensor4 cubatic_tensor = calcCubaticTensor(cubatic_orientation);
-                float cubatic_order_parameter = calcCubaticOrderParameter(cubatic_tensor, global_tensor);
-                float new_order_parameter = cubatic_order_parameter;
-
-                // set initial temperature and count
-                float t_current = m_t_initial;
-                unsigned int loop_count = 0;
-                // simulated annealing loop; loop counter to prevent inf loops
-                while ((t_current > m_t_final) && (loop_count < 10000))
+                for (unsigned int kl = 0; kl < 9; ++kl)
                 {
-                    ++loop_count;
-                    new_orientation = calcRandomQuaternion(dist, 0.1) * (cubatic_orientation);
-                    // now calculate the cubatic tensor
-                    tensor4 new_cubatic_tensor = calcCubaticTensor(new_orientation);
-                    new_order_parameter = calcCubaticOrderParameter(new_cubatic_tensor, global_tensor);
-                    if (new_order_parameter > cubatic_order_parameter)
-                    {
-                        cubatic_tensor = new_cubatic_tensor;
-                        cubatic_order_parameter = new_order_parameter;
-                        cubatic_orientation = new_orientation;
-                    }
-                    else
-                    {
-                        float boltzmann_factor
-                            = std::exp(-(cubatic_order_parameter - new_order_parameter) / t_current);
-                        if (boltzmann_factor >= dist())
-                        {
-                            cubatic_tensor = new_cubatic_tensor;
-                            cubatic_order_parameter = new_order_parameter;
-                            cubatic_orientation = new_orientation;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-                    t_current *= m_scale;
+                    value += basis[alpha](ij / 3, ij % 3) * tensor[9 * ij + kl] * basis[beta](kl / 3, kl % 3);
                 }
-                // set values
-                p_cubatic_tensor[i] = cubatic_tensor;
-                p_cubatic_orientation[i].s = cubatic_orientation.s;
-                p_cubatic_orientation[i].v = cubatic_orientation.v;
-                p_cubatic_order_parameter[i] = cubatic_order_parameter;
             }
-        });
-
-    // Loop over threads and choose the replicate that found the highest order.
-    unsigned int max_idx = 0;
-    float max_cubatic_order_parameter = p_cubatic_order_parameter[max_idx];
-    for (unsigned int i = 1; i < m_n_replicates; ++i)
+            unfolded(alpha, beta) = value;
+        }
+    }
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix<double, 6, 6>> unfolded_solver(unfolded);
+
+    // The eigenvectors of a generic matrix in the leading eigenspace give the
+    // cubatic axes. The matrices in this space with a repeated eigenvalue are
+    // spaced by an angle of pi/3, so at least one of two combinations spaced
+    // by pi/6 is well separated from them. Both are refined and the best
+    // result is kept.
+    double best_value = -std::numeric_limits<double>::infinity();
+    Eigen::Matrix3d best_rotation = Eigen::Matrix3d::Identity();
+    for (const double angle : {0.0, M_PI / 6})
     {
-        if (p_cubatic_order_parameter[i] > max_cubatic_order_parameter)
+        const Eigen::Matrix<double, 6, 1> coefficients
+            = std::cos(angle) * unfolded_solver.eigenvectors().col(5)
+            + std::sin(angle) * unfolded_solver.eigenvectors().col(4);
+        Eigen::Matrix3d seed = Eigen::Matrix3d::Zero();
+        for (unsigned int alpha = 0; alpha < 6; ++alpha)
+        {
+            seed += coefficients[alpha] * basis[alpha];
+        }
+        Eigen::Matrix3d rotation = Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d>(seed).eigenvectors();
+        if (rotation.determinant() < 0)
         {
-            max_idx = i;
-            max_cubatic_order_parameter = p_cubatic_order_parameter[i];
+            rotation.col(2) *= -1;
+        }
+
+        const double value = maximizeAlignment(tensor, rotation);
+        if (value > best_value)
+        {
+            best_value = value;
+            best_rotation = rotation;
         }
     }
 
-    m_cubatic_tensor.prepare({3, 3, 3, 3});
-    p_cubatic_tensor[max_idx].copyToManagedArray(m_cubatic_tensor);
-    m_cubatic_orientation = p_cubatic_orientation[max_idx];
-    m_cubatic_order_parameter = p_cubatic_order_parameter[max_idx];
+    const rotmat3<float> rotation(
+        vec3<float>(best_rotation(0, 0), best_rotation(0, 1), best_rotation(0, 2)),
+        vec3<float>(best_rotation(1, 0), best_rotation(1, 1), best_rotation(1, 2)),
+        vec3<float>(best_rotation(2, 0), best_rotation(2, 1), best_rotation(2, 2)));
+    quat<float> orientation(rotation);
+    return orientation * (float(1.0) / std::sqrt(norm2(orientation)));
+}
+
+void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
+{
+    m_n = num_orientations;
+    m_particle_order_parameter.prepare(m_n);
+
+    // Calculate the per-particle tensor
+    tensor4 global_tensor = calculateGlobalTensor(orientations);
+    m_global_tensor.prepare({3, 3, 3, 3});
+    global_tensor.copyToManagedArray(m_global_tensor);
 
-    // Now calculate the per-particle order parameters
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_n), [=](const tbb::blocked_range<size_t>& r) {
-        for (size_t i = r.begin(); i != r.end(); i++)
+    m_cubatic_orientation = calcCubaticOrientation(global_tensor);
+    tensor4 cubatic_tensor = calcCubaticTensor(m_cubatic_orientation);
+    m_cubatic_tensor.prepare({3, 3, 3, 3});
+    cubatic_tensor.copyToManagedArray(m_cubatic_tensor);
+    m_cubatic_order_parameter = calcCubaticOrderParameter(cubatic_tensor, global_tensor);
+
+    // The per-particle order parameter is defined as the value of the cubatic
+    // order parameter if the global orientation was the particle orientation.
+    // The norm of the cubatic tensor M does not depend on the orientation, and
+    // the global tensor only enters eq. 22 through its norm and through its
+    // contraction with M, which is a sum of contractions with each rotated
+    // basis vector.
+    const double cubatic_norm2 = dot(cubatic_tensor, cubatic_tensor);
+    const double global_norm2 = dot(global_tensor, global_tensor);
+    const double global_dot_r4 = dot(global_tensor, m_gen_r4_tensor);
+    util::forLoopWrapper(0, m_n, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
         {
-            // The per-particle order parameter is defined as the value of the
-            // cubatic order parameter if the global orientation was the
-            // particle orientation, so we can reuse the same machinery.
-            m_particle_order_parameter[i]
-                = calcCubaticOrderParameter(calcCubaticTensor(orientations[i]), global_tensor);
+            double contraction = 0;
+            for (const auto& m_system_vector : m_system_vectors)
+            {
+                contraction += global_tensor.contract(rotate(orientations[i], m_system_vector));
+            }
+            const double global_dot_cubatic = 2 * contraction - global_dot_r4;
+            m_particle_order_parameter[i] = static_cast<float>(
+                1.0 - (global_norm2 - 2 * global_dot_cubatic + cubatic_norm2) / cubatic_norm2);
         }
     });
 }
@@ -7,7 +7,6 @@
 #include "ManagedArray.h"
 #include "VectorMath.h"
 #include <array>
-#include <random>
 
 /*! \file Cubatic.h
     \brief Compute the cubatic order parameter for each particle.
@@ -31,6 +30,13 @@ struct tensor4
     tensor4 operator*(const float& b) const;
     float& operator[](unsigned int index);
 
+    //! Contract the tensor with the same vector along all four indices.
+    /*! The contraction is evaluated as a quadratic form of the 9x9 matrix
+     *  view of the tensor with the outer product of the vector with itself,
+     *  which the compiler can vectorize.
+     */
+    float contract(const vec3<float>& vector) const;
+
     void copyToManagedArray(util::ManagedArray<float>& ma);
 
     std::array<float, 81> data {0};
@@ -51,6 +57,15 @@ struct tensor4
  * are then constructed as homogeneous tensors constructed from this set (eq.
  * 3). The central idea of the paper is to then develop tensor functions of the
  * SOCs that can be used to quantify order.
+ *
+ * The paper recommends finding the cubatic orientation with a Newton-Raphson
+ * scheme. Since the norm of the cubatic tensor does not depend on its
+ * orientation, maximizing the order parameter is equivalent to maximizing the
+ * sum of the contractions of the global tensor with the three rotated basis
+ * vectors. This is done with Newton's method on the rotation group, starting
+ * from frames found in the eigenvectors of the global tensor, so the result is
+ * deterministic. The simulated annealing parameters are no longer used and
+ * are only kept for backwards compatibility.
  */
 class Cubatic
 {
@@ -132,7 +147,7 @@ private:
      *
      *  \return The cubatic tensor M_{\omega}.
      */
-    tensor4 calcCubaticTensor(quat<float>& orientation);
+    tensor4 calcCubaticTensor(const quat<float>& orientation) const;
 
     //! Calculate the scalar cubatic order parameter.
     /*! Implements eq. 22.
@@ -144,34 +159,25 @@ private:
      */
     static float calcCubaticOrderParameter(const tensor4& cubatic_tensor, const tensor4& global_tensor);
 
-    //! Calculate the per-particle tensor.
-    /*! Implements the first line of eq. 27, the calculation of M.
-     *
-     *  \param orientations The per-particle orientations.
-     *
-     *  \return The per-particle cubatic tensors value M^{ijkl}.
-     */
-    util::ManagedArray<tensor4> calculatePerParticleTensor(const quat<float>* orientations) const;
-
     //! Calculate the global tensor for the system.
-    /*! Implements the third line of eq. 27, the calculation of \bar{M}.
+    /*! Implements the third line of eq. 27, the calculation of \bar{M}. The
+     *  tensor is fully symmetric, so only its 15 distinct moments are summed
+     *  over the particles before it is expanded.
      */
-    tensor4 calculateGlobalTensor(quat<float>* orientations) const;
-
-    //! Calculate a random quaternion.
-    /*! To calculate a random quaternion in a way that obeys the right
-     *  distribution of angles, we cannot simply just choose 4 random numbers
-     *  and then normalize the quaternion. This function implements an
-     *  appropriate calculation. It is templated to allow easy input of
-     *  parameterized distributions using std::bind.
+    tensor4 calculateGlobalTensor(const quat<float>* orientations) const;
+
+    //! Find the orientation that maximizes the cubatic order parameter.
+    /*! \param global_tensor The tensor encoding the average system orientation (denoted \bar{M}).
+     *
+     *  \return The cubatic orientation.
      */
-    template<typename T> quat<float> calcRandomQuaternion(T& dist, float angle_multiplier = 1.0) const;
+    static quat<float> calcCubaticOrientation(const tensor4& global_tensor);
 
-    float m_t_initial;           //!< Initial temperature for simulated annealing.
-    float m_t_final;             //!< Final temperature for simulated annealing.
-    float m_scale;               //!< Scaling factor to reduce temperature.
-    unsigned int m_n_replicates; //!< Number of replicates.
-    unsigned int m_seed;         //!< Random seed.
+    float m_t_initial;           //!< Initial temperature for simulated annealing (unused).
+    float m_t_final;             //!< Final temperature for simulated annealing (unused).
+    float m_scale;               //!< Scaling factor to reduce temperature (unused).
+    unsigned int m_n_replicates; //!< Number of replicates (unused).
+    unsigned int m_seed;         //!< Random seed (unused).
     unsigned int m_n {0};        //!< Last number of points computed.
 
     float m_cubatic_order_parameter {0}; //!< The value of the order parameter.
@@ -183,7 +189,7 @@ private:
     util::ManagedArray<float> m_particle_order_parameter; //!< The per-particle value of the order parameter.
     util::ManagedArray<float>
         m_global_tensor; //!< The system-averaged homogeneous tensor encoding all particle orientations.
-    util::ManagedArray<float> m_cubatic_tensor; //!< The output tensor computed via simulated annealing.
+    util::ManagedArray<float> m_cubatic_tensor; //!< The cubatic tensor of the optimal orientation.
 
     std::array<vec3<float>, 3>
         m_system_vectors; //!< The global coordinate system, always use a simple Euclidean basis.
@@ -1,6 +1,11 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
 #include "HexaticTranslational.h"
 
 namespace freud { namespace order {
@@ -10,20 +15,22 @@ template<typename T>
 template<typename Func>
 void HexaticTranslational<T>::computeGeneral(Func func, const freud::locality::NeighborList* nlist,
                                              const freud::locality::NeighborQuery* points,
-                                             freud::locality::QueryArgs qargs, bool normalize_by_k)
+                                             freud::locality::QueryArgs qargs, unsigned int num_values,
+                                             float normalization)
 {
     const auto box = points->getBox();
     box.enforce2D();
 
     const unsigned int Np = points->getNPoints();
 
-    m_psi_array.prepare(Np);
+    m_psi_array.prepare({Np, num_values});
 
     freud::locality::loopOverNeighborsIterator(
         points, points->getPoints(), Np, qargs, nlist,
         [=](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
             float total_weight(0);
             const vec3<float> ref((*points)[i]);
+            std::complex<float>* psi = m_psi_array.get() + i * num_values;
 
             for (freud::locality::NeighborBond nb = ppiter->next(); !ppiter->end(); nb = ppiter->next())
             {
@@ -31,32 +38,70 @@ void HexaticTranslational<T>::computeGeneral(Func func, const freud::locality::N
                 const vec3<float> delta = box.wrap((*points)[nb.point_idx] - ref);
                 const float weight(m_weighted ? nb.weight : 1.0);
 
-                // Compute psi for this vector
-                m_psi_array[i] += weight * func(delta);
+                // Add the contributions of this vector to psi
+                func(delta, weight, psi);
                 total_weight += weight;
             }
-            if (normalize_by_k)
-            {
-                m_psi_array[i] /= std::complex<float>(m_k);
-            }
-            else
+            const std::complex<float> divisor(normalization != 0 ? normalization : total_weight);
+            for (unsigned int j = 0; j < num_values; ++j)
             {
-                m_psi_array[i] /= std::complex<float>(total_weight);
+                psi[j] /= divisor;
             }
         });
 }
 
-Hexatic::Hexatic(unsigned int k, bool weighted) : HexaticTranslational<unsigned int>(k, weighted) {}
+namespace {
+
+//! Raise a complex number to a nonnegative integer power by repeated squaring
+inline std::complex<float> integerPower(std::complex<float> base, unsigned int exponent)
+{
+    std::complex<float> result(1, 0);
+    while (exponent != 0)
+    {
+        if ((exponent & 1U) != 0)
+        {
+            result *= base;
+        }
+        base *= base;
+        exponent >>= 1U;
+    }
+    return result;
+}
+
+} // end anonymous namespace
+
+Hexatic::Hexatic(const std::vector<unsigned int>& ks, bool weighted)
+    : HexaticTranslational<std::vector<unsigned int>>(ks, weighted), m_k_order(ks.size())
+{
+    if (ks.empty())
+    {
+        throw std::invalid_argument("Hexatic requires at least one value of k.");
+    }
+    std::iota(m_k_order.begin(), m_k_order.end(), 0);
+    std::stable_sort(m_k_order.begin(), m_k_order.end(),
+                     [&ks](unsigned int a, unsigned int b) { return ks[a] < ks[b]; });
+}
 
 void Hexatic::compute(const freud::locality::NeighborList* nlist,
                       const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
 {
     computeGeneral(
-        [this](const vec3<float>& delta) {
-            const float theta_ij = std::atan2(delta.y, delta.x);
-            return std::exp(std::complex<float>(0, m_k * theta_ij));
+        [this](const vec3<float>& delta, float weight, std::complex<float>* psi) {
+            // The bond angle enters only through e^{i theta}, whose powers
+            // e^{i k theta} are built up from the previous smaller k.
+            const float r = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+            const std::complex<float> bond_phase
+                = (r > 0) ? std::complex<float>(delta.x / r, delta.y / r) : std::complex<float>(1, 0);
+            std::complex<float> power(1, 0);
+            unsigned int power_k = 0;
+            for (const unsigned int index : m_k_order)
+            {
+                power *= integerPower(bond_phase, m_k[index] - power_k);
+                power_k = m_k[index];
+                psi[index] += weight * power;
+            }
         },
-        nlist, points, qargs, false);
+        nlist, points, qargs, m_k.size(), 0);
 }
 
 Translational::Translational(float k, bool weighted) : HexaticTranslational<float>(k, weighted) {}
@@ -64,8 +109,11 @@ Translational::Translational(float k, bool weighted) : HexaticTranslational<floa
 void Translational::compute(const freud::locality::NeighborList* nlist,
                             const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
 {
-    computeGeneral([](const vec3<float>& delta) { return std::complex<float>(delta.x, delta.y); }, nlist,
-                   points, qargs, true);
+    computeGeneral(
+        [](const vec3<float>& delta, float weight, std::complex<float>* psi) {
+            psi[0] += weight * std::complex<float>(delta.x, delta.y);
+        },
+        nlist, points, qargs, 1, m_k);
 }
 
 }; }; // namespace freud::order
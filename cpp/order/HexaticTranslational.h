@@ -5,6 +5,7 @@
 #define HEXATIC_TRANSLATIONAL_H
 
 #include <complex>
+#include <vector>
 
 #include "Box.h"
 #include "ManagedArray.h"
@@ -41,7 +42,7 @@ public:
         return m_weighted;
     }
 
-    //! Get a reference to the order parameter array
+    //! Get a reference to the order parameter array, with one column per order parameter
     const util::ManagedArray<std::complex<float>>& getOrder() const
     {
         return m_psi_array;
@@ -49,25 +50,45 @@ public:
 
 protected:
     //! Compute the order parameter
+    /*! \param func Function called with the bond vector, the bond weight and
+     *         the row of m_psi_array of the query point, which adds the
+     *         weighted contributions of the bond to each order parameter.
+     *  \param num_values Number of order parameters computed for each point.
+     *  \param normalization Constant that the sums over bonds are divided by,
+     *         or zero to divide them by the total weight of the bonds.
+     */
     template<typename Func>
     void computeGeneral(Func func, const freud::locality::NeighborList* nlist,
                         const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs,
-                        bool normalize_by_k);
+                        unsigned int num_values, float normalization);
 
-    const T m_k; //!< The symmetry order for Hexatic, or normalization for Translational
+    const T m_k; //!< The symmetry orders for Hexatic, or normalization for Translational
     const bool
         m_weighted; //!< Whether to use neighbor weights in computing the order parameter (default false)
     util::ManagedArray<std::complex<float>> m_psi_array; //!< psi array computed
 };
 
 //! Compute the hexatic order parameter for a set of points
-/*!
+/*! The order parameters for several symmetries k are computed in a single
+ *  pass over the neighbors. For each bond, the unit complex number
+ *  e^{i theta} is found from the bond vector, and its integer powers for all
+ *  values of k are found by repeated multiplication in increasing order of k,
+ *  without evaluating any trigonometric functions.
  */
-class Hexatic : public HexaticTranslational<unsigned int>
+class Hexatic : public HexaticTranslational<std::vector<unsigned int>>
 {
 public:
     //! Constructor
-    Hexatic(unsigned int k = 6, bool weighted = false);
+    /*! \param ks Symmetry orders k of the order parameters, one column of
+     *         the order parameter array per value.
+     *  \param weighted Whether to use neighbor weights.
+     */
+    explicit Hexatic(const std::vector<unsigned int>& ks, bool weighted = false);
+
+    //! Constructor for a single symmetry order k
+    explicit Hexatic(unsigned int k = 6, bool weighted = false)
+        : Hexatic(std::vector<unsigned int> {k}, weighted)
+    {}
 
     //! Destructor
     ~Hexatic() override = default;
@@ -75,6 +96,9 @@ public:
     //! Compute the hexatic order parameter
     void compute(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
                  freud::locality::QueryArgs qargs);
+
+private:
+    std::vector<unsigned int> m_k_order; //!< Indices of the values of k sorted in increasing order of k
 };
 
 //! Compute the translational order parameter for a set of points
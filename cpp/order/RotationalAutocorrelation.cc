@@ -1,10 +1,13 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
+
 #include "RotationalAutocorrelation.h"
 
 #include "utils.h"
-#include <cmath>
 
 /*! \file RotationalAutocorrelation.cc
     \brief Implements the RotationalAutocorrelation class.
@@ -12,100 +15,167 @@
 
 namespace freud { namespace order {
 
-// This function wraps exponentiation for complex numbers to avoid
-// the case where pow((0,0), 0) returns (nan, nan). Additionally, it
-// serves as a micro-optimization since std::pow can be slow. We can take the
-// exponent to be an unsigned int since all the sums in the hyperspherical
-// harmonic below guarantee this.
-inline std::complex<float> cpow(std::complex<float> base, unsigned int p)
+RotationalAutocorrelation::RotationalAutocorrelation(const std::vector<unsigned int>& ls,
+                                                     unsigned int max_lag, unsigned int origin_interval)
+    : m_ls(ls), m_max_lag(max_lag), m_origin_interval(origin_interval), m_Ft(ls.size(), 0)
 {
-    if (p == 0)
+    if (m_ls.empty())
     {
-        return {1, 0};
+        throw std::invalid_argument("RotationalAutocorrelation requires at least one value of l.");
     }
-    std::complex<float> val(base);
-    for (unsigned int i = 1; i < p; i++)
+    if (m_origin_interval == 0)
     {
-        val *= base;
+        throw std::invalid_argument("RotationalAutocorrelation requires a positive origin_interval.");
     }
-    return val;
+    m_l_max = *std::max_element(m_ls.begin(), m_ls.end());
+    reset();
 }
 
-inline std::complex<float> RotationalAutocorrelation::hypersphere_harmonic(const std::complex<float> xi,
-                                                                           std::complex<float> zeta,
-                                                                           const unsigned int m1,
-                                                                           const unsigned int m2)
+void RotationalAutocorrelation::correlate(float s, float* chebyshev, float* values) const
 {
-    const std::complex<float> xi_conj = std::conj(xi);
-    const std::complex<float> zeta_conj = std::conj(zeta);
-
-    // Doing a summation over non-negative exponents, which requires the additional inner conditional.
-    std::complex<float> sum_tracker(0, 0);
-    for (unsigned int k = (m1 + m2 < m_l ? 0 : m1 + m2 - m_l); k <= std::min(m1, m2); k++)
+    // U_0(s) = 1, U_1(s) = 2s, U_{l+1}(s) = 2s U_l(s) - U_{l-1}(s)
+    chebyshev[0] = 1;
+    if (m_l_max > 0)
+    {
+        chebyshev[1] = 2 * s;
+    }
+    for (unsigned int l = 2; l <= m_l_max; ++l)
+    {
+        chebyshev[l] = 2 * s * chebyshev[l - 1] - chebyshev[l - 2];
+    }
+    for (unsigned int l_index = 0; l_index < m_ls.size(); ++l_index)
     {
-        float fact_product = static_cast<float>(m_factorials[k]) * m_factorials[m_l + k - m1 - m2]
-            * m_factorials[m1 - k] * m_factorials[m2 - k];
-        sum_tracker += cpow(xi_conj, k) * cpow(zeta, m2 - k) * cpow(zeta_conj, m1 - k)
-            * cpow(-xi, m_l + k - m1 - m2) / fact_product;
+        values[l_index] = chebyshev[m_ls[l_index]] / static_cast<float>(m_ls[l_index] + 1);
     }
-    return sum_tracker;
 }
 
 void RotationalAutocorrelation::compute(const quat<float>* ref_orientations, const quat<float>* orientations,
                                         unsigned int N)
 {
-    m_RA_array.prepare(N);
-
-    // Precompute the hyperspherical harmonics for the unit quaternion. The
-    // default quaternion constructor gives a unit quaternion. We will assume
-    // the same iteration order here as in the loop below to save ourselves
-    // from having to use a more expensive process (i.e. a map).
-    std::complex<float> xi = std::complex<float>(0, 0);
-    std::complex<float> zeta = std::complex<float>(0, 1);
-    std::vector<std::complex<float>> unit_harmonics;
-    std::vector<std::vector<float>> prefactors(m_l + 1, std::vector<float>(m_l + 1, float(0)));
-    for (unsigned int a = 0; a <= m_l; a++)
+    const auto num_ls = static_cast<unsigned int>(m_ls.size());
+    m_RA_array.prepare({N, num_ls});
+
+    // Parallel loop is over orientations (technically (ref_or, or) pairs).
+    tbb::enumerable_thread_specific<std::vector<double>> local_sums(std::vector<double>(num_ls, 0));
+    util::forLoopWrapper(0, N, [&](size_t begin, size_t end) {
+        std::vector<double>& sums = local_sums.local();
+        std::vector<float> chebyshev(m_l_max + 1);
+        std::vector<float> values(num_ls);
+        for (size_t i = begin; i < end; ++i)
+        {
+            // The real part of the relative rotation conj(ref) * q.
+            const quat<float>& ref = ref_orientations[i];
+            const quat<float>& q = orientations[i];
+            correlate(ref.s * q.s + dot(ref.v, q.v), chebyshev.data(), values.data());
+            for (unsigned int l_index = 0; l_index < num_ls; ++l_index)
+            {
+                m_RA_array(i, l_index) = values[l_index];
+                sums[l_index] += values[l_index];
+            }
+        }
+    });
+
+    for (unsigned int l_index = 0; l_index < num_ls; ++l_index)
     {
-        for (unsigned int b = 0; b <= m_l; b++)
+        double RA_sum(0);
+        for (const auto& sums : local_sums)
         {
-            unit_harmonics.push_back(std::conj(hypersphere_harmonic(xi, zeta, a, b)));
-            prefactors[a][b] = static_cast<float>(m_factorials[a] * m_factorials[m_l - a] * m_factorials[b]
-                                                  * m_factorials[m_l - b])
-                / (static_cast<float>(m_l + 1));
+            RA_sum += sums[l_index];
         }
+        m_Ft[l_index] = static_cast<float>(RA_sum / static_cast<double>(N));
     }
+}
 
-    // Parallel loop is over orientations (technically (ref_or, or) pairs).
-    util::forLoopWrapper(0, N, [=](size_t begin, size_t end) {
+void RotationalAutocorrelation::reset()
+{
+    m_num_frames = 0;
+    m_num_points = 0;
+    m_origins.clear();
+    m_correlation_sums.assign((m_max_lag + 1) * m_ls.size(), 0);
+    m_origin_counts.assign(m_max_lag + 1, 0);
+    m_correlation.prepare({m_max_lag + 1, static_cast<unsigned int>(m_ls.size())});
+    m_num_origins.prepare(m_max_lag + 1);
+}
+
+void RotationalAutocorrelation::accumulate(const quat<float>* orientations, unsigned int N)
+{
+    if (m_num_frames == 0)
+    {
+        m_num_points = N;
+    }
+    else if (N != m_num_points)
+    {
+        throw std::invalid_argument("The number of orientations must be the same in every frame.");
+    }
+    const unsigned int frame = m_num_frames;
+    const auto num_ls = static_cast<unsigned int>(m_ls.size());
+
+    // Drop the origins that are too old to be correlated with this frame,
+    // and store this frame if it is an origin.
+    while (!m_origins.empty() && frame - m_origins.front().frame > m_max_lag)
+    {
+        m_origins.pop_front();
+    }
+    if (frame % m_origin_interval == 0)
+    {
+        m_origins.push_back({frame, std::vector<quat<float>>(orientations, orientations + N)});
+    }
+    const auto num_origins = static_cast<unsigned int>(m_origins.size());
+
+    // Each orientation of this frame is correlated with the same orientation
+    // in all origins in a single pass over the frame.
+    tbb::enumerable_thread_specific<std::vector<double>> local_sums(
+        std::vector<double>(num_origins * num_ls, 0));
+    util::forLoopWrapper(0, N, [&](size_t begin, size_t end) {
+        std::vector<double>& sums = local_sums.local();
+        std::vector<float> chebyshev(m_l_max + 1);
+        std::vector<float> values(num_ls);
         for (size_t i = begin; i < end; ++i)
         {
-            // Transform the orientation quaternions into Xi/Zeta coordinates;
-            quat<float> qq_1 = conj(ref_orientations[i]) * orientations[i];
-            std::complex<float> xi = std::complex<float>(qq_1.v.x, qq_1.v.y);
-            std::complex<float> zeta = std::complex<float>(qq_1.v.z, qq_1.s);
-
-            // Loop through the valid quantum numbers.
-            m_RA_array[i] = std::complex<float>(0, 0);
-            unsigned int uh_index = 0;
-            for (unsigned int a = 0; a <= m_l; a++)
+            const quat<float>& q = orientations[i];
+            for (unsigned int origin = 0; origin < num_origins; ++origin)
             {
-                for (unsigned int b = 0; b <= m_l; b++)
+                const quat<float>& ref = m_origins[origin].orientations[i];
+                correlate(ref.s * q.s + dot(ref.v, q.v), chebyshev.data(), values.data());
+                for (unsigned int l_index = 0; l_index < num_ls; ++l_index)
                 {
-                    std::complex<float> combined_value
-                        = unit_harmonics[uh_index] * hypersphere_harmonic(xi, zeta, a, b);
-                    m_RA_array[i] += prefactors[a][b] * combined_value;
-                    uh_index += 1;
+                    sums[origin * num_ls + l_index] += values[l_index];
                 }
             }
         }
     });
 
-    float RA_sum(0);
-    for (unsigned int i = 0; i < N; i++)
+    for (unsigned int origin = 0; origin < num_origins; ++origin)
     {
-        RA_sum += std::real(m_RA_array[i]);
+        const unsigned int lag = frame - m_origins[origin].frame;
+        for (const auto& sums : local_sums)
+        {
+            for (unsigned int l_index = 0; l_index < num_ls; ++l_index)
+            {
+                m_correlation_sums[lag * num_ls + l_index] += sums[origin * num_ls + l_index];
+            }
+        }
+        ++m_origin_counts[lag];
+    }
+    ++m_num_frames;
+
+    // Average the sums over particles and origins.
+    m_correlation.prepare({m_max_lag + 1, num_ls});
+    m_num_origins.prepare(m_max_lag + 1);
+    for (unsigned int lag = 0; lag <= m_max_lag; ++lag)
+    {
+        m_num_origins[lag] = m_origin_counts[lag];
+        if (m_origin_counts[lag] == 0)
+        {
+            continue;
+        }
+        const double normalization = 1.0 / (static_cast<double>(m_origin_counts[lag]) * N);
+        for (unsigned int l_index = 0; l_index < num_ls; ++l_index)
+        {
+            m_correlation(lag, l_index)
+                = static_cast<float>(m_correlation_sums[lag * num_ls + l_index] * normalization);
+        }
     }
-    m_Ft = RA_sum / static_cast<float>(N);
-};
+}
 
 }; }; // end namespace freud::order
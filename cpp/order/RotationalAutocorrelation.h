@@ -5,6 +5,8 @@
 #define ROTATIONAL_AUTOCORRELATION_H
 
 #include <complex>
+#include <deque>
+#include <vector>
 
 #include "ManagedArray.h"
 #include "VectorMath.h"
@@ -40,6 +42,25 @@ std::pair<std::complex<float>, std::complex<float>> quat_to_greek(const quat<flo
  *  representation of the rotations. For details, see "Design rules for
  *  engineering colloidal plastic crystals of hard polyhedra – phase behavior
  *  and directional entropic forces" by Karas et al. (currently in preparation).
+ *
+ *  The autocorrelation of an orientation with its reference is the product of
+ *  the hyperspherical harmonics of the unit quaternion and of the relative
+ *  rotation, summed over m1 and m2. The harmonics of the unit quaternion
+ *  vanish unless m1 = -m2, which reduces this sum to the normalized trace of
+ *  the irreducible representation of SU(2) of dimension l + 1, i.e. its
+ *  character. With \f$ s = \cos(\omega / 2) \f$ the real part of the
+ *  relative quaternion, the autocorrelation is therefore
+ *  \f[ \frac{\sin((l + 1) \omega / 2)}{(l + 1) \sin(\omega / 2)} = \frac{U_l(s)}{l + 1}, \f]
+ *  where \f$ U_l \f$ is the Chebyshev polynomial of the second kind. The
+ *  polynomials of all l are found with a single three-term recurrence, so
+ *  several l are computed for the cost of the largest one.
+ *
+ *  Besides computing the autocorrelation of a single pair of frames, the
+ *  time correlation of a trajectory can be accumulated by passing its frames
+ *  in order to accumulate(). Every origin_interval-th frame is stored as a
+ *  reference origin, and each frame is correlated with all origins at most
+ *  max_lag frames before it. The correlation for each lag is averaged over
+ *  all particles and origins.
  */
 class RotationalAutocorrelation
 {
@@ -48,37 +69,48 @@ public:
     RotationalAutocorrelation() = default;
 
     //! Constructor
-    /*! \param l The order of the spherical harmonic.
+    /*! \param ls The orders of the hyperspherical harmonics.
+     *  \param max_lag Largest lag in frames of the accumulated time correlation.
+     *  \param origin_interval Number of frames between the reference origins
+     *         of the accumulated time correlation.
      */
-    explicit RotationalAutocorrelation(unsigned int l) : m_l(l)
-    {
-        // For efficiency, we precompute all required factorials for use during
-        // the per-particle computation.
-        m_factorials.prepare(m_l + 1);
-        m_factorials[0] = 1;
-        for (unsigned int i = 1; i <= m_l; i++)
-        {
-            m_factorials[i] = i * m_factorials[i - 1];
-        }
-    }
+    explicit RotationalAutocorrelation(const std::vector<unsigned int>& ls, unsigned int max_lag = 0,
+                                       unsigned int origin_interval = 1);
+
+    //! Constructor for a single l
+    explicit RotationalAutocorrelation(unsigned int l)
+        : RotationalAutocorrelation(std::vector<unsigned int> {l})
+    {}
 
     //! Destructor
     ~RotationalAutocorrelation() = default;
 
-    //! Get the quantum number l used in calculations.
-    unsigned int getL() const
+    //! Get the quantum numbers l used in calculations.
+    const std::vector<unsigned int>& getL() const
+    {
+        return m_ls;
+    }
+
+    //! Get the largest lag of the accumulated time correlation.
+    unsigned int getMaxLag() const
+    {
+        return m_max_lag;
+    }
+
+    //! Get the number of frames between reference origins.
+    unsigned int getOriginInterval() const
     {
-        return m_l;
+        return m_origin_interval;
     }
 
-    //! Get a reference to the last computed rotational autocorrelation array.
+    //! Get a reference to the last computed rotational autocorrelation array, with one column per l.
     const util::ManagedArray<std::complex<float>>& getRAArray() const
     {
         return m_RA_array;
     }
 
-    //! Get a reference to the last computed value of the rotational autocorrelation.
-    float getRotationalAutocorrelation() const
+    //! Get a reference to the last computed value of the rotational autocorrelation for each l.
+    const std::vector<float>& getRotationalAutocorrelation() const
     {
         return m_Ft;
     }
@@ -89,39 +121,71 @@ public:
      *  \param N The number of orientations.
      *
      *  This function loops over all provided orientations and reference
-     *  orientations and computes their hyperspherical harmonics for the
-     *  desired range of quantum numbers. For each orientation/reference
-     *  pair, the autocorrelation value is computed as the inner product of
-     *  these two hyperspherical harmonics. The value of the autocorrelation
-     *  for the whole system is then the average of the real parts of the
-     *  autocorrelation for the whole system.
+     *  orientations and computes the autocorrelation of each pair for every
+     *  l. The value of the autocorrelation for the whole system is then the
+     *  average of the autocorrelation over all pairs.
      */
     void compute(const quat<float>* ref_orientations, const quat<float>* orientations, unsigned int N);
 
-private:
-    //! Compute a hyperspherical harmonic.
-    /*! \param xi The first complex number coordinate.
-     *  \param zeta The second complex number coordinate.
-     *  \param l The azimuthal quantum number.
-     *  \param m1 The first magnetic quantum number.
-     *  \param m2 The second magnetic quantum number.
-     *  \return The value of the hyperspherical harmonic (l, m1, m2) at (xi, zeta).
-     *
-     *  The hyperspherical harmonic function is a generalization of spherical
-     *  harmonics from the 2-sphere to the 3-sphere. For details, see Harmonic
-     *  functions and matrix elements for hyperspherical quantum field models
-     *  (https://doi.org/10.1063/1.526210). The function needs to be a class
-     *  method to access the cached factorial values for the class's value of
-     *  m_l.
+    //! Forget all accumulated frames.
+    void reset();
+
+    //! Add the next frame of a trajectory to the accumulated time correlation.
+    /*! \param orientations Quaternions in the frame.
+     *  \param N The number of orientations, which must be the same in every frame.
      */
-    std::complex<float> hypersphere_harmonic(const std::complex<float> xi, std::complex<float> zeta,
-                                             const unsigned int m1, const unsigned int m2);
+    void accumulate(const quat<float>* orientations, unsigned int N);
 
-    unsigned int m_l; //!< Order of the hyperspherical harmonic.
-    float m_Ft {0};   //!< Real value of calculated RA function.
+    //! Get the number of frames accumulated since construction or the last reset.
+    unsigned int getNumFrames() const
+    {
+        return m_num_frames;
+    }
 
-    util::ManagedArray<std::complex<float>> m_RA_array; //!< Array of RA values per particle
-    util::ManagedArray<unsigned int> m_factorials;      //!< Array of cached factorials
+    //! Get the accumulated time correlation for each lag and l.
+    /*! Lags that no frame has reached yet are zero.
+     */
+    const util::ManagedArray<float>& getCorrelation() const
+    {
+        return m_correlation;
+    }
+
+    //! Get the number of origins averaged over for each lag.
+    const util::ManagedArray<unsigned int>& getNumOrigins() const
+    {
+        return m_num_origins;
+    }
+
+private:
+    //! Compute the autocorrelation of a pair of orientations for every l.
+    /*! \param s The real part of the relative rotation of the pair.
+     *  \param chebyshev Scratch space for the l_max + 1 Chebyshev polynomials.
+     *  \param values Output with one value per l.
+     */
+    void correlate(float s, float* chebyshev, float* values) const;
+
+    //! Reference origin of the accumulated time correlation
+    struct Origin
+    {
+        unsigned int frame;                   //!< Index of the frame of the origin
+        std::vector<quat<float>> orientations; //!< Orientations in that frame
+    };
+
+    std::vector<unsigned int> m_ls;    //!< Orders of the hyperspherical harmonics.
+    unsigned int m_l_max {0};          //!< Largest order.
+    unsigned int m_max_lag {0};        //!< Largest lag of the time correlation.
+    unsigned int m_origin_interval {1}; //!< Number of frames between origins.
+    std::vector<float> m_Ft;           //!< Real value of calculated RA function for each l.
+
+    util::ManagedArray<std::complex<float>> m_RA_array; //!< Array of RA values per particle and l
+
+    unsigned int m_num_frames {0};                  //!< Number of accumulated frames
+    unsigned int m_num_points {0};                  //!< Number of orientations in each frame
+    std::deque<Origin> m_origins;                   //!< Origins within max_lag of the last frame
+    std::vector<double> m_correlation_sums;         //!< Summed correlation for each lag and l
+    std::vector<unsigned int> m_origin_counts;      //!< Number of origins summed for each lag
+    util::ManagedArray<float> m_correlation;        //!< Averaged correlation for each lag and l
+    util::ManagedArray<unsigned int> m_num_origins; //!< Number of origins for each lag
 };
 
 }; }; // end namespace freud::order
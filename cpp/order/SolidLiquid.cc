@@ -33,25 +33,33 @@ void SolidLiquid::compute(const freud::locality::NeighborList* nlist,
     const auto& ql = m_steinhardt.getQl();
 
     // Compute (normalized) dot products for each bond in the neighbor list
+    // and count the solid-like bonds of each query point. The bonds of each
+    // query point are contiguous, so both are found in a single pass over
+    // the CSR offsets of the neighbor list.
     const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
     const unsigned int num_bonds(m_nlist.getNumBonds());
+    const auto& offsets = m_nlist.getOffsets();
+    const auto& neighbors = m_nlist.getNeighbors();
     m_ql_ij.prepare(num_bonds);
+    m_number_of_connections.prepare(num_query_points);
 
     util::forLoopWrapper(
         0, num_query_points,
-        [=](size_t begin, size_t end) {
-            for (unsigned int i = begin; i != end; ++i)
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i)
             {
-                unsigned int bond(m_nlist.find_first_index(i));
-                for (; bond < num_bonds && m_nlist.getNeighbors()(bond, 0) == i; ++bond)
+                const std::complex<float>* qlmi = &qlm(i, 0);
+                unsigned int num_solid_bonds(0);
+                for (unsigned int bond = offsets[i]; bond < offsets[i + 1]; ++bond)
                 {
-                    const unsigned int j(m_nlist.getNeighbors()(bond, 1));
+                    const unsigned int j(neighbors(bond, 1));
+                    const std::complex<float>* qlmj = &qlm(j, 0);
 
                     // Accumulate the dot product over m of qlmi and qlmj vectors
                     std::complex<float> bond_ql_ij = 0;
                     for (unsigned int k = 0; k < m_num_ms; k++)
                     {
-                        bond_ql_ij += qlm(i, k) * std::conj(qlm(j, k));
+                        bond_ql_ij += qlmi[k] * std::conj(qlmj[k]);
                     }
 
                     // Optionally normalize dot products by points' ql values,
@@ -61,43 +69,31 @@ void SolidLiquid::compute(const freud::locality::NeighborList* nlist,
                         bond_ql_ij *= normalizationfactor / (ql[i] * ql[j]);
                     }
                     m_ql_ij[bond] = bond_ql_ij.real();
+                    if (m_ql_ij[bond] > m_q_threshold)
+                    {
+                        ++num_solid_bonds;
+                    }
                 }
+                m_number_of_connections[i] = num_solid_bonds;
             }
         },
         true);
 
-    // Filter neighbors to contain only solid-like bonds
-    std::vector<bool> solid_filter(num_bonds);
-    for (unsigned int bond(0); bond < num_bonds; bond++)
-    {
-        solid_filter[bond] = (m_ql_ij[bond] > m_q_threshold);
-    }
-    freud::locality::NeighborList solid_nlist(m_nlist);
-    solid_nlist.filter(solid_filter.cbegin());
-
-    // Save the neighbor counts of solid-like bonds for each query point
-    m_number_of_connections.prepare(num_query_points);
-    for (unsigned int i(0); i < num_query_points; i++)
-    {
-        m_number_of_connections[i] = solid_nlist.getCounts()[i];
-    }
-
-    // Filter nlist to only bonds between solid-like particles
-    // (particles with more than solid_threshold solid-like bonds)
-    const unsigned int num_solid_bonds(solid_nlist.getNumBonds());
-    std::vector<bool> neighbor_count_filter(num_solid_bonds);
-    for (unsigned int bond(0); bond < num_solid_bonds; bond++)
-    {
-        const unsigned int i(solid_nlist.getNeighbors()(bond, 0));
-        const unsigned int j(solid_nlist.getNeighbors()(bond, 1));
-        neighbor_count_filter[bond] = (m_number_of_connections[i] >= m_solid_threshold
-                                       && m_number_of_connections[j] >= m_solid_threshold);
-    }
-    freud::locality::NeighborList solid_neighbor_nlist(solid_nlist);
-    solid_neighbor_nlist.filter(neighbor_count_filter.cbegin());
+    // Mark the solid-like bonds between solid-like particles (particles with
+    // at least solid_threshold solid-like bonds), which are the bonds used
+    // for clustering.
+    util::ManagedArray<bool> cluster_bonds(num_bonds);
+    util::forLoopWrapper(0, num_bonds, [&](size_t begin, size_t end) {
+        for (size_t bond = begin; bond != end; ++bond)
+        {
+            cluster_bonds[bond] = m_ql_ij[bond] > m_q_threshold
+                && m_number_of_connections[neighbors(bond, 0)] >= m_solid_threshold
+                && m_number_of_connections[neighbors(bond, 1)] >= m_solid_threshold;
+        }
+    });
 
     // Find clusters of solid-like particles
-    m_cluster.compute(points, &solid_neighbor_nlist, qargs);
+    m_cluster.compute(points->getNPoints(), m_nlist, cluster_bonds.get());
 }
 
 }; }; // end namespace freud::order
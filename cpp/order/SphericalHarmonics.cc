@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <algorithm>
+#include <cmath>
+
+#include "SphericalHarmonics.h"
+
+/*! \file SphericalHarmonics.cc
+    \brief Evaluates sums of spherical harmonics over bond vectors.
+*/
+
+namespace freud { namespace order {
+
+SphericalHarmonics::SphericalHarmonics(const std::vector<unsigned int>& ls) : m_ls(ls), m_offsets(1, 0)
+{
+    for (const unsigned int l : m_ls)
+    {
+        m_offsets.push_back(m_offsets.back() + 2 * l + 1);
+        m_l_max = std::max(m_l_max, l);
+    }
+    m_offsets_by_l.resize(m_l_max + 1);
+    for (unsigned int l_index = 0; l_index < m_ls.size(); ++l_index)
+    {
+        m_offsets_by_l[m_ls[l_index]].push_back(m_offsets[l_index]);
+    }
+
+    // The diagonal values include the Condon-Shortley phase (-1)^m.
+    m_diagonal.resize(m_l_max + 1);
+    m_recurrence_offsets.resize(m_l_max + 2);
+    double diagonal = 1.0 / std::sqrt(4.0 * M_PI);
+    for (unsigned int m = 0; m <= m_l_max; ++m)
+    {
+        if (m > 0)
+        {
+            diagonal *= -std::sqrt((2.0 * m + 1.0) / (2.0 * m));
+        }
+        m_diagonal[m] = static_cast<float>(diagonal);
+
+        // P_j^m = a_jm (z P_{j-1}^m - b_jm P_{j-2}^m) for j = m+1..l_max
+        m_recurrence_offsets[m] = static_cast<unsigned int>(m_recurrence_a.size());
+        for (unsigned int j = m + 1; j <= m_l_max; ++j)
+        {
+            const double jj = double(j) * j;
+            const double mm = double(m) * m;
+            const double a = std::sqrt((4.0 * jj - 1.0) / (jj - mm));
+            const double b = (j == m + 1) ? 0.0
+                                          : std::sqrt(((j - 1.0) * (j - 1.0) - mm)
+                                                      / (4.0 * (j - 1.0) * (j - 1.0) - 1.0));
+            m_recurrence_a.push_back(static_cast<float>(a));
+            m_recurrence_b.push_back(static_cast<float>(b));
+        }
+    }
+    m_recurrence_offsets[m_l_max + 1] = static_cast<unsigned int>(m_recurrence_a.size());
+}
+
+void SphericalHarmonics::flush()
+{
+    // Pad the batch with bonds of zero weight, so every loop below runs over
+    // the full batch.
+    for (unsigned int b = m_num_buffered; b < batch_size; ++b)
+    {
+        m_x[b] = 0;
+        m_y[b] = 0;
+        m_z[b] = 1;
+        m_weights[b] = 0;
+    }
+    m_num_buffered = 0;
+
+    // Normalize the bonds, pointing bonds of length zero along z.
+    for (unsigned int b = 0; b < batch_size; ++b)
+    {
+        const float r_sq = m_x[b] * m_x[b] + m_y[b] * m_y[b] + m_z[b] * m_z[b];
+        const bool nonzero = r_sq > 0;
+        const float inv_r = nonzero ? 1 / std::sqrt(r_sq) : 0;
+        m_x[b] *= inv_r;
+        m_y[b] *= inv_r;
+        m_z[b] = nonzero ? m_z[b] * inv_r : 1;
+    }
+
+    // Powers (x + iy)^m, the Cartesian form of sin^m(theta) e^{im phi}.
+    float power_re[batch_size];
+    float power_im[batch_size];
+    for (unsigned int b = 0; b < batch_size; ++b)
+    {
+        power_re[b] = 1;
+        power_im[b] = 0;
+    }
+
+    float legendre[batch_size];
+    float legendre_prev[batch_size];
+    for (unsigned int m = 0; m <= m_l_max; ++m)
+    {
+        if (m > 0)
+        {
+            for (unsigned int b = 0; b < batch_size; ++b)
+            {
+                const float re = power_re[b] * m_x[b] - power_im[b] * m_y[b];
+                const float im = power_re[b] * m_y[b] + power_im[b] * m_x[b];
+                power_re[b] = re;
+                power_im[b] = im;
+            }
+        }
+
+        for (unsigned int b = 0; b < batch_size; ++b)
+        {
+            legendre[b] = m_diagonal[m];
+            legendre_prev[b] = 0;
+        }
+        for (unsigned int l = m; l <= m_l_max; ++l)
+        {
+            if (l > m)
+            {
+                const unsigned int k = m_recurrence_offsets[m] + l - m - 1;
+                const float a = m_recurrence_a[k];
+                const float c = m_recurrence_b[k];
+                for (unsigned int b = 0; b < batch_size; ++b)
+                {
+                    const float next = a * (m_z[b] * legendre[b] - c * legendre_prev[b]);
+                    legendre_prev[b] = legendre[b];
+                    legendre[b] = next;
+                }
+            }
+            if (m_offsets_by_l[l].empty())
+            {
+                continue;
+            }
+
+            float sum_re = 0;
+            float sum_im = 0;
+            for (unsigned int b = 0; b < batch_size; ++b)
+            {
+                const float weighted = m_weights[b] * legendre[b];
+                sum_re += weighted * power_re[b];
+                sum_im += weighted * power_im[b];
+            }
+
+            // Y_l^{-m} = (-1)^m conj(Y_l^m)
+            const float sign = (m % 2 == 0) ? 1 : -1;
+            for (const unsigned int offset : m_offsets_by_l[l])
+            {
+                m_ylm[offset + m] += std::complex<float>(sum_re, sum_im);
+                if (m > 0)
+                {
+                    m_ylm[offset + l + m] += std::complex<float>(sign * sum_re, -sign * sum_im);
+                }
+            }
+        }
+    }
+}
+
+}; }; // end namespace freud::order
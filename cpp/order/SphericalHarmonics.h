@@ -0,0 +1,134 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef SPHERICAL_HARMONICS_H
+#define SPHERICAL_HARMONICS_H
+
+#include <complex>
+#include <vector>
+
+#include "VectorMath.h"
+
+/*! \file SphericalHarmonics.h
+    \brief Evaluates sums of spherical harmonics over bond vectors.
+*/
+
+namespace freud { namespace order {
+
+//! Accumulates weighted sums of spherical harmonics over bond vectors
+/*! The spherical harmonics are evaluated directly from the Cartesian
+    components of the unit bond vectors without any trigonometric functions,
+    using \f$ Y_l^m(\hat{r}) = \bar{P}_l^m(z) (x + iy)^m \f$ for \f$ m \geq 0 \f$,
+    where \f$ \bar{P}_l^m \f$ is the normalized associated Legendre function
+    with the factor \f$ \sin^m\theta \f$ removed. \f$ \bar{P}_l^m \f$ is found
+    with the standard three-term recurrence in l, whose coefficients are
+    precomputed by the constructor, and negative m follow from
+    \f$ Y_l^{-m} = (-1)^m \overline{Y_l^m} \f$. The harmonics include the
+    Condon-Shortley phase, matching scipy.special.sph_harm. The recurrence
+    for the largest requested l passes through every smaller l, so any number
+    of l values are evaluated for the cost of the largest one.
+
+    Bonds are buffered and evaluated in batches laid out as separate arrays of
+    x, y and z components, so that the inner loops over the bonds of a batch
+    are simple enough for the compiler to vectorize. Evaluators hold scratch
+    space and are meant to be reused, e.g. one per thread.
+
+    Usage:
+    \code
+    evaluator.begin(ylm);
+    for (each bond) evaluator.addBond(bond, weight);
+    evaluator.end();
+    \endcode
+    After end(), ylm has been incremented by the weighted sums of the
+    harmonics over all bonds. The output holds a block of 2l+1 values for
+    every requested l, in the order in which the l values were given. Within
+    the block of an l, entry k holds \f$ Y_l^m \f$ with m = k for k <= l and
+    m = l - k for k > l, i.e. the order is m = 0, 1, ..., l, -1, ..., -l.
+*/
+class SphericalHarmonics
+{
+public:
+    //! Number of bonds evaluated together
+    static constexpr unsigned int batch_size = 16;
+
+    //! Constructor
+    /*! \param ls Spherical harmonic numbers l to evaluate.
+     */
+    explicit SphericalHarmonics(const std::vector<unsigned int>& ls);
+
+    //! Constructor for a single l
+    explicit SphericalHarmonics(unsigned int l) : SphericalHarmonics(std::vector<unsigned int> {l}) {}
+
+    //! Get the spherical harmonic numbers l
+    const std::vector<unsigned int>& getLs() const
+    {
+        return m_ls;
+    }
+
+    //! Get the offset of the block of the l_index-th l in the output
+    unsigned int getOffset(unsigned int l_index) const
+    {
+        return m_offsets[l_index];
+    }
+
+    //! Get the total number of values in the output, the sum of 2l+1 over all l
+    unsigned int getNumValues() const
+    {
+        return m_offsets.back();
+    }
+
+    //! Start accumulating bonds into the getNumValues() values pointed to by ylm
+    void begin(std::complex<float>* ylm)
+    {
+        m_ylm = ylm;
+        m_num_buffered = 0;
+    }
+
+    //! Add the harmonics of a bond vector, which need not be normalized
+    /*! A bond of length zero is treated as pointing along z.
+     */
+    void addBond(const vec3<float>& bond, float weight)
+    {
+        m_x[m_num_buffered] = bond.x;
+        m_y[m_num_buffered] = bond.y;
+        m_z[m_num_buffered] = bond.z;
+        m_weights[m_num_buffered] = weight;
+        if (++m_num_buffered == batch_size)
+        {
+            flush();
+        }
+    }
+
+    //! Finish accumulating the bonds added since begin
+    void end()
+    {
+        if (m_num_buffered != 0)
+        {
+            flush();
+        }
+    }
+
+private:
+    //! Add the buffered bonds to the output and empty the buffer
+    void flush();
+
+    std::vector<unsigned int> m_ls;      //!< Spherical harmonic numbers l
+    std::vector<unsigned int> m_offsets; //!< Output offset of each l, followed by the output size
+    unsigned int m_l_max {0};            //!< Largest l
+    std::vector<std::vector<unsigned int>> m_offsets_by_l; //!< Output offsets of each l up to m_l_max
+    std::vector<float> m_diagonal;     //!< Normalized P_m^m (without sin^m) for m = 0..l_max
+    std::vector<float> m_recurrence_a; //!< First coefficient of the recurrence in l, per (m, l)
+    std::vector<float> m_recurrence_b; //!< Second coefficient of the recurrence in l, per (m, l)
+    std::vector<unsigned int> m_recurrence_offsets; //!< Start of the coefficients for each m
+
+    std::complex<float>* m_ylm {nullptr}; //!< Output of the current accumulation
+    unsigned int m_num_buffered {0};      //!< Number of buffered bonds
+    float m_x[batch_size] {};             //!< Buffered bond x components
+    float m_y[batch_size] {};             //!< Buffered bond y components
+    float m_z[batch_size] {};             //!< Buffered bond z components
+    float m_weights[batch_size] {};       //!< Buffered bond weights
+};
+
+}; }; // end namespace freud::order
+
+#endif // SPHERICAL_HARMONICS_H
@@ -1,6 +1,8 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <stdexcept>
+
 #include "Steinhardt.h"
 #include "NeighborComputeFunctional.h"
 #include "utils.h"
@@ -11,48 +13,43 @@
 
 namespace freud { namespace order {
 
-// Calculating Ylm using fsph module
-void Steinhardt::computeYlm(const float theta, const float phi, std::vector<std::complex<float>>& Ylm) const
+Steinhardt::Steinhardt(const std::vector<unsigned int>& ls, bool average, bool wl, bool weighted,
+                       bool wl_normalize)
+    : m_ls(ls), m_average(average), m_wl(wl), m_weighted(weighted), m_wl_normalize(wl_normalize),
+      m_ylm_evaluators(SphericalHarmonics(ls))
 {
-    if (Ylm.size() != m_num_ms)
+    if (m_ls.empty())
     {
-        Ylm.resize(m_num_ms);
+        throw std::invalid_argument("Steinhardt requires at least one value of l.");
     }
-
-    fsph::PointSPHEvaluator<float> sph_eval(m_l);
-
-    unsigned int m_index(0);
-    sph_eval.compute(theta, phi);
-
-    for (typename fsph::PointSPHEvaluator<float>::iterator iter(sph_eval.begin_l(m_l, 0, true));
-         iter != sph_eval.end(); ++iter)
+    for (const unsigned int l : m_ls)
     {
-        // Manually add the Condon-Shortley phase, (-1)^m, to positive odd m
-        float phase = 1;
-        if (m_index <= m_l && m_index % 2 == 1)
+        m_offsets.push_back(m_num_ms);
+        m_num_ms += 2 * l + 1;
+        if (m_wl)
         {
-            phase = -1;
+            m_wigner3j.push_back(&Wigner3j::get(l));
         }
-
-        Ylm[m_index] = phase * (*iter);
-        ++m_index;
     }
+    m_qlm_local.resize(m_num_ms);
 }
 
 void Steinhardt::reallocateArrays(unsigned int Np)
 {
     m_Np = Np;
+    const auto num_ls = static_cast<unsigned int>(m_ls.size());
     m_qlmi.prepare({Np, m_num_ms});
     m_qlm.prepare(m_num_ms);
-    m_qli.prepare(Np);
+    m_qli.prepare({Np, num_ls});
     if (m_average)
     {
         m_qlmiAve.prepare({Np, m_num_ms});
-        m_qliAve.prepare(Np);
+        m_qlmiNeighborSum.prepare({Np, m_num_ms});
+        m_qliAve.prepare({Np, num_ls});
     }
     if (m_wl)
     {
-        m_wli.prepare(Np);
+        m_wli.prepare({Np, num_ls});
     }
 }
 
@@ -62,12 +59,25 @@ void Steinhardt::compute(const freud::locality::NeighborList* nlist,
     // Allocate and zero out arrays as necessary.
     reallocateArrays(points->getNPoints());
 
-    // Computes the base qlmi required for each specialized order parameter
-    baseCompute(nlist, points, qargs);
-
     if (m_average)
     {
-        computeAve(nlist, points, qargs);
+        // Averaging needs the neighbors of every neighbor, so the neighbor
+        // list is built once up front and shared by both passes.
+        freud::locality::NeighborList default_nlist;
+        if (nlist == nullptr)
+        {
+            default_nlist
+                = freud::locality::makeDefaultNlist(points, nlist, points->getPoints(), m_Np, qargs);
+            nlist = &default_nlist;
+        }
+        // Computes the base qlmi required for each specialized order parameter
+        baseCompute(nlist, points, qargs);
+        computeAve(*nlist);
+    }
+    else
+    {
+        // Computes the base qlmi required for each specialized order parameter
+        baseCompute(nlist, points, qargs);
     }
 
     // Reduce qlm
@@ -84,13 +94,12 @@ void Steinhardt::compute(const freud::locality::NeighborList* nlist,
             aggregatewl(m_wli, m_qlmi, m_qli);
         }
     }
-    m_norm = normalizeSystem();
+    normalizeSystem();
 }
 
 void Steinhardt::baseCompute(const freud::locality::NeighborList* nlist,
                              const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
 {
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
     // For consistency, this reset is done here regardless of whether the array
     // is populated in baseCompute or computeAve.
     m_qlm_local.reset();
@@ -99,165 +108,162 @@ void Steinhardt::baseCompute(const freud::locality::NeighborList* nlist,
         [=](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
             float total_weight(0);
             const vec3<float> ref((*points)[i]);
+            // The harmonics of all l and all bonds are summed directly into
+            // this particle's qlm.
+            std::complex<float>* qlmi = &m_qlmi(i, 0);
+            SphericalHarmonics& ylm_evaluator = m_ylm_evaluators.local();
+            ylm_evaluator.begin(qlmi);
             for (freud::locality::NeighborBond nb = ppiter->next(); !ppiter->end(); nb = ppiter->next())
             {
                 const vec3<float> delta = points->getBox().wrap((*points)[nb.point_idx] - ref);
                 const float weight(m_weighted ? nb.weight : float(1.0));
-
-                // phi is usually in range 0..2Pi, but
-                // it only appears in Ylm as exp(im\phi),
-                // so range -Pi..Pi will give same results.
-                float phi = std::atan2(delta.y, delta.x); // -Pi..Pi
-
-                // This value must be clamped in cases where the particles are
-                // aligned along z, otherwise due to floating point error we
-                // could get delta.z/nb.distance = -1-eps, which is outside the
-                // valid range of std::acos.
-                float theta = std::acos(util::clamp(delta.z / nb.distance, -1, 1)); // 0..Pi
-
-                // If the points are directly on top of each other,
-                // theta should be zero instead of nan.
-                if (nb.distance == float(0))
-                {
-                    theta = 0;
-                }
-
-                std::vector<std::complex<float>> Ylm(m_num_ms);
-                computeYlm(theta, phi, Ylm); // Fill up Ylm
-
-                for (unsigned int k = 0; k < m_num_ms; ++k)
-                {
-                    m_qlmi({static_cast<unsigned int>(i), k}) += weight * Ylm[k];
-                }
+                ylm_evaluator.addBond(delta, weight);
                 total_weight += weight;
             } // End loop going over neighbor bonds
+            ylm_evaluator.end();
 
             // Normalize!
             for (unsigned int k = 0; k < m_num_ms; ++k)
             {
-                // Cache the index for efficiency.
-                const unsigned int index = m_qlmi.getIndex({static_cast<unsigned int>(i), k});
-                m_qlmi[index] /= total_weight;
-                // Add the norm, which is the (complex) squared magnitude
-                m_qli[i] += norm(m_qlmi[index]);
-                // This array gets populated by computeAve in the averaging case.
-                if (!m_average)
+                qlmi[k] /= total_weight;
+            }
+            // This array gets populated by computeAve in the averaging case.
+            if (!m_average)
+            {
+                auto& qlm_local = m_qlm_local.local();
+                for (unsigned int k = 0; k < m_num_ms; ++k)
                 {
-                    m_qlm_local.local()[k] += m_qlmi[index] / float(m_Np);
+                    qlm_local[k] += qlmi[k] / float(m_Np);
                 }
             }
-            m_qli[i] *= normalizationfactor;
-            m_qli[i] = std::sqrt(m_qli[i]);
+            computeQl(qlmi, &m_qli(i, 0));
         });
 }
 
-void Steinhardt::computeAve(const freud::locality::NeighborList* nlist,
-                            const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
+void Steinhardt::computeAve(const freud::locality::NeighborList& nlist)
 {
-    std::shared_ptr<locality::NeighborQueryIterator> iter;
-    if (nlist == nullptr)
-    {
-        iter = points->query(points->getPoints(), points->getNPoints(), qargs);
-    }
-
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
+    // The average of qlmi over the second neighbor shell of particle i is
+    // (qlm_i + sum_{j in N(i)} sum_{k in N(j)} qlm_k) / (1 + sum_{j in N(i)} |N(j)|).
+    // The inner sums are shared by all neighbors j of every particle, so they
+    // are gathered once per particle over the CSR structure of the neighbor
+    // list, after which the average costs a second gather of the same size.
+    const auto& offsets = nlist.getOffsets();
+    const auto& neighbors = nlist.getNeighbors();
 
-    freud::locality::loopOverNeighborsIterator(
-        points, points->getPoints(), m_Np, qargs, nlist,
-        [=](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
-            unsigned int neighborcount(1);
-            for (freud::locality::NeighborBond nb1 = ppiter->next(); !ppiter->end(); nb1 = ppiter->next())
+    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j)
+        {
+            std::complex<float>* neighbor_sum = &m_qlmiNeighborSum(j, 0);
+            for (unsigned int bond = offsets[j]; bond < offsets[j + 1]; ++bond)
             {
-                // Since we need to find neighbors of neighbors, we need to add some extra logic here to
-                // create the appropriate iterators.
-                std::shared_ptr<freud::locality::NeighborPerPointIterator> ns_neighbors_iter;
-                if (nlist != nullptr)
-                {
-                    ns_neighbors_iter
-                        = std::make_shared<locality::NeighborListPerPointIterator>(nlist, nb1.point_idx);
-                }
-                else
+                const std::complex<float>* qlmk = &m_qlmi(neighbors(bond, 1), 0);
+                for (unsigned int k = 0; k < m_num_ms; ++k)
                 {
-                    ns_neighbors_iter = iter->query(nb1.point_idx);
+                    neighbor_sum[k] += qlmk[k];
                 }
+            }
+        }
+    });
 
-                for (freud::locality::NeighborBond nb2 = ns_neighbors_iter->next(); !ns_neighbors_iter->end();
-                     nb2 = ns_neighbors_iter->next())
+    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+        auto& qlm_local = m_qlm_local.local();
+        for (size_t i = begin; i < end; ++i)
+        {
+            // Start with the qlm of the particle i itself.
+            std::complex<float>* qlmiAve = &m_qlmiAve(i, 0);
+            const std::complex<float>* qlmi = &m_qlmi(i, 0);
+            for (unsigned int k = 0; k < m_num_ms; ++k)
+            {
+                qlmiAve[k] = qlmi[k];
+            }
+            unsigned int neighborcount(1);
+            for (unsigned int bond = offsets[i]; bond < offsets[i + 1]; ++bond)
+            {
+                const unsigned int j = neighbors(bond, 1);
+                const std::complex<float>* neighbor_sum = &m_qlmiNeighborSum(j, 0);
+                for (unsigned int k = 0; k < m_num_ms; ++k)
                 {
-                    for (unsigned int k = 0; k < m_num_ms; ++k)
-                    {
-                        // Adding all the qlm of the neighbors. We use the
-                        // vector function signature for indexing into the
-                        // arrays for speed.
-                        m_qlmiAve({static_cast<unsigned int>(i), k}) += m_qlmi({nb2.point_idx, k});
-                    }
-                    neighborcount++;
-                } // End loop over particle neighbor's bonds
-            }     // End loop over particle's bonds
+                    qlmiAve[k] += neighbor_sum[k];
+                }
+                neighborcount += offsets[j + 1] - offsets[j];
+            }
 
             // Normalize!
             for (unsigned int k = 0; k < m_num_ms; ++k)
             {
-                // Cache the index for efficiency.
-                const unsigned int index = m_qlmiAve.getIndex({static_cast<unsigned int>(i), k});
-                // Adding the qlm of the particle i itself
-                m_qlmiAve[index] += m_qlmi[index];
-                m_qlmiAve[index] /= static_cast<float>(neighborcount);
-                m_qlm_local.local()[k] += m_qlmiAve[index] / float(m_Np);
-                // Add the norm, which is the complex squared magnitude
-                m_qliAve[i] += norm(m_qlmiAve[index]);
+                qlmiAve[k] /= static_cast<float>(neighborcount);
+                qlm_local[k] += qlmiAve[k] / float(m_Np);
             }
-            m_qliAve[i] *= normalizationfactor;
-            m_qliAve[i] = std::sqrt(m_qliAve[i]);
-        });
+            computeQl(qlmiAve, &m_qliAve(i, 0));
+        }
+    });
 }
 
-float Steinhardt::normalizeSystem()
+void Steinhardt::computeQl(const std::complex<float>* qlm, float* ql) const
 {
-    float calc_norm(0);
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
-    for (unsigned int k = 0; k < m_num_ms; ++k)
+    for (unsigned int l_index = 0; l_index < m_ls.size(); ++l_index)
     {
-        // Add the norm, which is the complex squared magnitude
-        calc_norm += norm(m_qlm[k]);
+        const unsigned int num_ms = 2 * m_ls[l_index] + 1;
+        const std::complex<float>* qlm_l = qlm + m_offsets[l_index];
+        float sum(0);
+        for (unsigned int k = 0; k < num_ms; ++k)
+        {
+            // Add the norm, which is the (complex) squared magnitude
+            sum += norm(qlm_l[k]);
+        }
+        ql[l_index] = std::sqrt(sum * float(4.0 * M_PI / num_ms));
     }
-    const float ql_system_norm = std::sqrt(calc_norm * normalizationfactor);
+}
+
+void Steinhardt::normalizeSystem()
+{
+    m_norm.resize(m_ls.size());
+    computeQl(m_qlm.get(), m_norm.data());
 
     if (m_wl)
     {
-        auto wigner3jvalues = getWigner3j(m_l);
-        float wl_system_norm = reduceWigner3j(m_qlm.get(), m_l, wigner3jvalues);
-
-        // The normalization factor of wl is calculated using qli, which is
-        // equivalent to calculate the normalization factor from qlmi
-        if (m_wl_normalize)
+        for (unsigned int l_index = 0; l_index < m_ls.size(); ++l_index)
         {
-            const float wl_normalization = std::sqrt(normalizationfactor) / ql_system_norm;
-            wl_system_norm *= wl_normalization * wl_normalization * wl_normalization;
+            const unsigned int l = m_ls[l_index];
+            const float ql_system_norm = m_norm[l_index];
+            float wl_system_norm = m_wigner3j[l_index]->reduce(m_qlm.get() + m_offsets[l_index]);
+
+            // The normalization factor of wl is calculated using qli, which is
+            // equivalent to calculate the normalization factor from qlmi
+            if (m_wl_normalize)
+            {
+                const auto normalizationfactor = float(4.0 * M_PI / (2 * l + 1));
+                const float wl_normalization = std::sqrt(normalizationfactor) / ql_system_norm;
+                wl_system_norm *= wl_normalization * wl_normalization * wl_normalization;
+            }
+            m_norm[l_index] = wl_system_norm;
         }
-        return wl_system_norm;
     }
-
-    return ql_system_norm;
 }
 
 void Steinhardt::aggregatewl(util::ManagedArray<float>& target,
                              const util::ManagedArray<std::complex<float>>& source,
                              const util::ManagedArray<float>& normalization_source) const
 {
-    auto wigner3jvalues = getWigner3j(m_l);
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
-    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
-        for (size_t i = begin; i < end; ++i)
-        {
-            target[i] = reduceWigner3j(&(source({static_cast<unsigned int>(i), 0})), m_l, wigner3jvalues);
-            if (m_wl_normalize)
+    for (unsigned int l_index = 0; l_index < m_ls.size(); ++l_index)
+    {
+        const unsigned int l = m_ls[l_index];
+        const unsigned int offset = m_offsets[l_index];
+        const Wigner3j& wigner3j = *m_wigner3j[l_index];
+        const auto normalizationfactor = float(4.0 * M_PI / (2 * l + 1));
+        util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
             {
-                const float normalization = std::sqrt(normalizationfactor) / normalization_source[i];
-                target[i] *= normalization * normalization * normalization;
+                target(i, l_index) = wigner3j.reduce(&source(i, offset));
+                if (m_wl_normalize)
+                {
+                    const float normalization
+                        = std::sqrt(normalizationfactor) / normalization_source(i, l_index);
+                    target(i, l_index) *= normalization * normalization * normalization;
+                }
             }
-        }
-    });
+        });
+    }
 }
 
 }; }; // end namespace freud::order
@@ -5,15 +5,17 @@
 #define STEINHARDT_H
 
 #include <complex>
+#include <tbb/enumerable_thread_specific.h>
+#include <vector>
 
 #include "Box.h"
 #include "ManagedArray.h"
 #include "NeighborList.h"
 #include "NeighborQuery.h"
+#include "SphericalHarmonics.h"
 #include "ThreadStorage.h"
 #include "VectorMath.h"
 #include "Wigner3j.h"
-#include "fsph/src/spherical_harmonics.hpp"
 
 /*! \file Steinhardt.h
     \brief Computes variants of Steinhardt order parameters.
@@ -48,6 +50,10 @@ namespace freud { namespace order {
  * If the flag wl_normalize is set, the third-order invariant wl order parameter
  * will be normalized.
  *
+ * Any number of l values may be computed together. The spherical harmonics of
+ * all l are evaluated in a single pass over the bonds, and every per-particle
+ * result array has one column per l, in the order the l values were given.
+ *
  * For more details see:
  * - PJ Steinhardt (1983) (DOI: 10.1103/PhysRevB.28.784)
  * - Wolfgang Lechner (2008) (DOI: 10.1063/Journal of Chemical Physics 129.114707)
@@ -58,14 +64,16 @@ class Steinhardt
 public:
     //! Steinhardt Class Constructor
     /*! Constructor for Steinhardt analysis class.
-     *  \param l Spherical harmonic number l.
-     *           Must be a positive number.
+     *  \param ls Spherical harmonic numbers l.
+     *            Must contain at least one value.
      */
+    explicit Steinhardt(const std::vector<unsigned int>& ls, bool average = false, bool wl = false,
+                        bool weighted = false, bool wl_normalize = false);
+
+    //! Steinhardt Class Constructor for a single l
     explicit Steinhardt(unsigned int l, bool average = false, bool wl = false, bool weighted = false,
                         bool wl_normalize = false)
-        : m_l(l), m_num_ms(2 * l + 1), m_average(average), m_wl(wl), m_weighted(weighted),
-          m_wl_normalize(wl_normalize), m_qlm_local(2 * l + 1)
-
+        : Steinhardt(std::vector<unsigned int> {l}, average, wl, weighted, wl_normalize)
     {}
 
     //! Empty destructor
@@ -77,7 +85,7 @@ public:
         return m_Np;
     }
 
-    //! Get the last calculated order parameter
+    //! Get the last calculated order parameter, with one column per l
     const util::ManagedArray<float>& getParticleOrder() const
     {
         if (m_wl)
@@ -87,7 +95,7 @@ public:
         return getQl();
     }
 
-    //! Get the last calculated ql
+    //! Get the last calculated ql, with one column per l
     const util::ManagedArray<float>& getQl() const
     {
         if (m_average)
@@ -98,13 +106,16 @@ public:
     }
 
     //! Get the last calculated qlm for each particle
+    /*! Each row holds 2l+1 values for every l in turn, using the m ordering
+     *  of SphericalHarmonics.
+     */
     const util::ManagedArray<std::complex<float>>& getQlm() const
     {
         return m_qlmi;
     }
 
-    //! Get system-normalized order
-    float getOrder() const
+    //! Get system-normalized order for each l
+    const std::vector<float>& getOrder() const
     {
         return m_norm;
     }
@@ -137,17 +148,13 @@ public:
     void compute(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
                  freud::locality::QueryArgs qargs);
 
-    unsigned int getL() const
+    //! Get the spherical harmonic numbers l
+    const std::vector<unsigned int>& getL() const
     {
-        return m_l;
+        return m_ls;
     }
 
 private:
-    //! \internal
-    //! Spherical harmonics calculation for Ylm filling a
-    //  std::vector<std::complex<float> > with values for m = -l..l.
-    void computeYlm(const float theta, const float phi, std::vector<std::complex<float>>& Ylm) const;
-
     template<typename T> std::shared_ptr<T> makeArray(size_t size);
 
     //! Reallocates only the necessary arrays when the number of particles changes
@@ -159,12 +166,18 @@ private:
                      freud::locality::QueryArgs qargs);
 
     //! Calculates the neighbor average ql order parameter
-    void computeAve(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
-                    freud::locality::QueryArgs qargs);
+    /*! The averages are gathered over the second neighbor shell given by
+     *  the CSR structure of nlist, which must be the neighbor list used by
+     *  baseCompute.
+     */
+    void computeAve(const freud::locality::NeighborList& nlist);
 
-    //! Compute the system-wide order by averaging over particles, then
-    //  reducing over the m values to produce a single scalar.
-    float normalizeSystem();
+    //! Compute ql for every l from one row of qlm
+    void computeQl(const std::complex<float>* qlm, float* ql) const;
+
+    //! Compute the system-wide order for each l by averaging over particles,
+    //  then reducing over the m values to produce a single scalar.
+    void normalizeSystem();
 
     //! Sum over Wigner 3j coefficients to compute third-order invariants
     //  wl from second-order invariants ql
@@ -172,9 +185,10 @@ private:
                      const util::ManagedArray<float>& normalization_source) const;
 
     // Member variables used for compute
-    unsigned int m_Np {0}; //!< Last number of points computed
-    unsigned int m_l;      //!< Spherical harmonic l value.
-    unsigned int m_num_ms; //!< The number of magnetic quantum numbers (2*m_l+1).
+    unsigned int m_Np {0};          //!< Last number of points computed
+    std::vector<unsigned int> m_ls;      //!< Spherical harmonic l values.
+    std::vector<unsigned int> m_offsets; //!< Offset of the qlm of each l within a row of m_qlmi
+    unsigned int m_num_ms {0}; //!< The number of magnetic quantum numbers (2*l+1) summed over all l.
 
     // Flags
     bool m_average;      //!< Whether to take a second shell average (default false)
@@ -185,14 +199,18 @@ private:
     util::ManagedArray<std::complex<float>> m_qlmi;       //!< qlm for each particle i
     util::ManagedArray<std::complex<float>> m_qlm;        //!< Normalized qlm(Ave) for the whole system
     util::ThreadStorage<std::complex<float>> m_qlm_local; //!< Thread-specific m_qlm(Ave)
-    util::ManagedArray<float> m_qli;    //!< ql locally invariant order parameter for each particle i
-    util::ManagedArray<float> m_qliAve; //!< Averaged ql with 2nd neighbor shell for each particle i
+    util::ManagedArray<float> m_qli;    //!< ql locally invariant order parameter for each particle i and l
+    util::ManagedArray<float> m_qliAve; //!< Averaged ql with 2nd neighbor shell for each particle i and l
+    util::ManagedArray<std::complex<float>>
+        m_qlmiAve;               //!< Averaged qlm with 2nd neighbor shell for each particle i
     util::ManagedArray<std::complex<float>>
-        m_qlmiAve; //!< Averaged qlm with 2nd neighbor shell for each particle i
-    util::ManagedArray<std::complex<float>> m_qlmAve; //!< Normalized qlmiAve for the whole system
-    float m_norm {0};                                 //!< System normalized order parameter
+        m_qlmiNeighborSum; //!< Sum of the qlm of the neighbors of each particle i, used for averaging
+    std::vector<float> m_norm; //!< System normalized order parameter for each l
     util::ManagedArray<float>
-        m_wli; //!< wl order parameter for each particle i, also used for wl averaged data
+        m_wli; //!< wl order parameter for each particle i and l, also used for wl averaged data
+    std::vector<const Wigner3j*> m_wigner3j; //!< Wigner 3j coefficients of each l, used for wl
+    tbb::enumerable_thread_specific<SphericalHarmonics>
+        m_ylm_evaluators; //!< Thread-specific spherical harmonic evaluators
 };
 
 }; };  // end namespace freud::order
@@ -8,58 +8,74 @@
 #include <vector>
 
 /*! \file Wigner3j.h
- *  \brief Stores and reduces over Wigner 3j coefficients for l from 0 to 20
+ *  \brief Computes and reduces over Wigner 3j coefficients for any l
  */
 
 namespace freud { namespace order {
 
-//! Compute array index for m values, indexed like:
-//  [0, 1, ..., l, -1, -2, ..., -l]
-int lmIndex(int l, int m);
-
-//! Reduce an array using Wigner 3j coefficients to construct a
-//  third-order rotational invariant quantity.
-//  source array must be indexed by m, like [0, 1, ..., l, -1, -2, ..., -l].
-float reduceWigner3j(const std::complex<float>* source, unsigned int l_, const std::vector<double>& wigner3j);
-
-std::vector<double> getWigner3j(unsigned int l);
-// All Wigner 3j coefficients created using sympy
-/*
-
-from sympy.physics.wigner import wigner_3j
-import numpy as np
-import json
+//! Third-order rotational invariant built from Wigner 3j coefficients
+/*! For a single l, this class reduces an array of \f$ q_{lm} \f$ to
+ *  \f[ \sum_{m_1 + m_2 + m_3 = 0}
+ *      \begin{pmatrix} l & l & l \\ m_1 & m_2 & m_3 \end{pmatrix}
+ *      q_{lm_1} q_{lm_2} q_{lm_3}. \f]
+ *  The 3j symbols are computed when the object is constructed, with the
+ *  three-term recurrence in \f$ m_2 \f$ of Schulten and Gordon (1975) for
+ *  each \f$ m_1 \f$, which is stable for any l.
+ *
+ *  Since all three angular momenta are equal, the symbol changes by
+ *  \f$ (-1)^{3l} \f$ under an odd permutation of the columns. The terms of
+ *  the sum are therefore grouped by the sorted triple
+ *  \f$ m_1 \leq m_2 \leq m_3 \f$, weighted by its number of distinct
+ *  permutations, and the sum vanishes identically for odd l. Only these
+ *  nonzero terms are stored, as packed lists of indices and values.
+ *
+ *  Use get() to share the coefficients of each l across the whole process.
+ */
+class Wigner3j
+{
+public:
+    //! Constructor
+    /*! \param l Spherical harmonic number l.
+     */
+    explicit Wigner3j(unsigned int l);
 
-wigner = {}
-for l in range(21):
-    wigner[l] = []
-    for m1 in range(-l, l+1):
-        for m2 in range(max(-l-m1, -l), min(l-m1, l)+1):
-            m3 = -m1-m2
-            wigner[l].append(float(wigner_3j(l, l, l, m1, m2, m3)))
+    //! Get the coefficients for l, computing them on first use
+    /*! The coefficients are cached for the lifetime of the process and this
+     *  function may be called from multiple threads.
+     */
+    static const Wigner3j& get(unsigned int l);
 
-with open('wigner3j.json', 'w') as jsonfile:
-    json.dump(wigner, jsonfile, sort_keys=True, indent=4)
+    //! Get the spherical harmonic number l
+    unsigned int getL() const
+    {
+        return m_l;
+    }
 
-WIGNER_COEFF = """
-    case {l}:
-    {{
-        return {{
-{values}
-        }};
-    }}"""
+    //! Get the number of nonzero terms in the reduction
+    unsigned int getNumTerms() const
+    {
+        return static_cast<unsigned int>(m_values.size());
+    }
 
-def format_values(values, per_line=4, spaces=12):
-    lines = []
-    for line in range(int(np.ceil(len(values)/per_line))):
-        lines.append(', '.join(
-            map(str, values[line*per_line:min(len(values), (line+1)*per_line)])))
-    return ' '*spaces + (',\n' + ' '*spaces).join(lines)
+    //! Reduce an array of qlm to the third-order invariant
+    /*! \param qlm The 2l+1 values of qlm, indexed by m like
+     *         [0, 1, ..., l, -1, -2, ..., -l].
+     */
+    float reduce(const std::complex<float>* qlm) const;
 
-for l in sorted(wigner.keys()):
-    print(WIGNER_COEFF.format(l=l, values=format_values(wigner[l])))
+    //! Compute the Wigner 3j symbols (l l l; m1 m2 -m1-m2) for a fixed m1
+    /*! The symbols are returned for m2 from max(-l, -l - m1) to
+     *  min(l, l - m1).
+     */
+    static std::vector<double> computeSymbols(unsigned int l, int m1);
 
-*/
+private:
+    unsigned int m_l;                    //!< Spherical harmonic number l
+    std::vector<unsigned int> m_indices1; //!< Index of m1 in qlm for each term
+    std::vector<unsigned int> m_indices2; //!< Index of m2 in qlm for each term
+    std::vector<unsigned int> m_indices3; //!< Index of m3 in qlm for each term
+    std::vector<float> m_values;         //!< Coefficient of each term
+};
 
 }; };  // end namespace freud::order
 #endif // WIGNER3J_H
@@ -8,7 +8,7 @@ cimport freud.util
 from freud.util cimport uint, vec3
 
 
-cdef extern from "Cluster.h" namespace "freud::cluster":
+cdef extern from "Cluster.h" namespace "freud::cluster" nogil:
     cdef cppclass Cluster:
         Cluster() except +
         void compute(const freud._locality.NeighborQuery*,
@@ -19,11 +19,41 @@ cdef extern from "Cluster.h" namespace "freud::cluster":
         const freud.util.ManagedArray[unsigned int] &getClusterIdx() const
         const vector[vector[uint]] getClusterKeys() const
 
-cdef extern from "ClusterProperties.h" namespace "freud::cluster":
+cdef extern from "ClusterProperties.h" namespace "freud::cluster" nogil:
     cdef cppclass ClusterProperties:
         ClusterProperties()
         void compute(const freud._locality.NeighborQuery*,
-                     const unsigned int*) except +
+                     const unsigned int*,
+                     const float*) except +
         const freud.util.ManagedArray[vec3[float]] &getClusterCenters() const
         const freud.util.ManagedArray[float] &getClusterGyrations() const
         const freud.util.ManagedArray[unsigned int] &getClusterSizes() const
+        const freud.util.ManagedArray[float] &getClusterMasses() const
+        const freud.util.ManagedArray[float] &getClusterRadiiOfGyration() const
+        const freud.util.ManagedArray[float] &getClusterAnisotropies() const
+
+cdef extern from "ClusterTracker.h" namespace "freud::cluster" nogil:
+    ctypedef enum ClusterEventType "freud::cluster::ClusterEventType":
+        birth "freud::cluster::ClusterEventType::birth"
+        death "freud::cluster::ClusterEventType::death"
+        merge "freud::cluster::ClusterEventType::merge"
+        split "freud::cluster::ClusterEventType::split"
+
+    cdef cppclass ClusterEvent:
+        ClusterEventType type
+        unsigned int previous_id
+        unsigned int current_id
+
+    cdef cppclass ClusterTracker:
+        ClusterTracker(unsigned int) except +
+        void compute(const freud._locality.NeighborQuery*,
+                     const freud._locality.NeighborList*,
+                     freud._locality.QueryArgs) except +
+        void reset()
+        unsigned int getMinSize() const
+        unsigned int getNumFrames() const
+        unsigned int getNumClusters() const
+        unsigned int getNumTrackedClusters() const
+        const freud.util.ManagedArray[unsigned int] &getClusterIdx() const
+        const freud.util.ManagedArray[unsigned int] &getClusterIds() const
+        vector[ClusterEvent] getEvents() const
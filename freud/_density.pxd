@@ -11,7 +11,7 @@ from freud.util cimport vec3
 
 ctypedef unsigned int uint
 
-cdef extern from "CorrelationFunction.h" namespace "freud::density":
+cdef extern from "CorrelationFunction.h" namespace "freud::density" nogil:
     cdef cppclass CorrelationFunction[T](BondHistogramCompute):
         CorrelationFunction(float, float) except +
         void accumulate(const freud._locality.NeighborQuery*, const T*,
@@ -21,9 +21,16 @@ cdef extern from "CorrelationFunction.h" namespace "freud::density":
                         freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[T] &getCorrelation()
 
-cdef extern from "GaussianDensity.h" namespace "freud::density":
+cdef extern from "GaussianDensity.h" namespace "freud::density" nogil:
+    ctypedef enum GaussianDensityMode:
+        Auto
+        Direct
+        Separable
+        FFT
+
     cdef cppclass GaussianDensity:
-        GaussianDensity(vec3[unsigned int], float, float) except +
+        GaussianDensity(vec3[unsigned int], float, float,
+                        GaussianDensityMode) except +
         const freud._box.Box & getBox() const
         void reset()
         void compute(const freud._locality.NeighborQuery*,
@@ -32,8 +39,9 @@ cdef extern from "GaussianDensity.h" namespace "freud::density":
         vec3[unsigned int] getWidth() const
         float getSigma() const
         float getRMax() const
+        GaussianDensityMode getMode() const
 
-cdef extern from "LocalDensity.h" namespace "freud::density":
+cdef extern from "LocalDensity.h" namespace "freud::density" nogil:
     cdef cppclass LocalDensity:
         LocalDensity(float, float)
         const freud._box.Box & getBox() const
@@ -47,7 +55,7 @@ cdef extern from "LocalDensity.h" namespace "freud::density":
         float getRMax() const
         float getDiameter() const
 
-cdef extern from "RDF.h" namespace "freud::density":
+cdef extern from "RDF.h" namespace "freud::density" nogil:
     cdef cppclass RDF(BondHistogramCompute):
         RDF(float, float, float, bool) except +
         const freud._box.Box & getBox() const
@@ -59,12 +67,12 @@ cdef extern from "RDF.h" namespace "freud::density":
         const freud.util.ManagedArray[float] &getRDF()
         const freud.util.ManagedArray[float] &getNr()
 
-cdef extern from "SphereVoxelization.h" namespace "freud::density":
+cdef extern from "SphereVoxelization.h" namespace "freud::density" nogil:
     cdef cppclass SphereVoxelization:
         SphereVoxelization(vec3[unsigned int], float) except +
         const freud._box.Box & getBox() const
         void reset()
         void compute(const freud._locality.NeighborQuery*) except +
-        const freud.util.ManagedArray[unsigned int] &getVoxels() const
+        const freud.util.ManagedArray[unsigned int] &getVoxelBits() const
         vec3[unsigned int] getWidth() const
         float getRMax() const
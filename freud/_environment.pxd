@@ -13,7 +13,7 @@ from freud._locality cimport BondHistogramCompute
 from freud.util cimport quat, vec3
 
 
-cdef extern from "BondOrder.h" namespace "freud::environment":
+cdef extern from "BondOrder.h" namespace "freud::environment" nogil:
     ctypedef enum BondOrderMode:
         bod
         lbod
@@ -33,7 +33,7 @@ cdef extern from "BondOrder.h" namespace "freud::environment":
         const freud.util.ManagedArray[float] &getBondOrder()
         BondOrderMode getMode() const
 
-cdef extern from "LocalDescriptors.h" namespace "freud::environment":
+cdef extern from "LocalDescriptors.h" namespace "freud::environment" nogil:
     ctypedef enum LocalDescriptorOrientation:
         LocalNeighborhood
         Global
@@ -57,7 +57,7 @@ cdef extern from "LocalDescriptors.h" namespace "freud::environment":
         LocalDescriptorOrientation getMode() const
         bool getNegativeM() const
 
-cdef extern from "MatchEnv.h" namespace "freud::environment":
+cdef extern from "MatchEnv.h" namespace "freud::environment" nogil:
     map[unsigned int, unsigned int] minimizeRMSD(
         const freud._box.Box &, const vec3[float]*, vec3[float]*, unsigned int,
         float &, bool) except +
@@ -109,7 +109,7 @@ cdef extern from "MatchEnv.h" namespace "freud::environment":
         const freud.util.ManagedArray[unsigned int] &getClusters()
         vector[vector[vec3[float]]] &getClusterEnvironments()
 
-cdef extern from "AngularSeparation.h" namespace "freud::environment":
+cdef extern from "AngularSeparation.h" namespace "freud::environment" nogil:
     cdef cppclass AngularSeparationGlobal:
         AngularSeparationGlobal()
         void compute(quat[float]*,
@@ -133,7 +133,7 @@ cdef extern from "AngularSeparation.h" namespace "freud::environment":
         const freud.util.ManagedArray[float] &getAngles() const
         freud._locality.NeighborList * getNList()
 
-cdef extern from "LocalBondProjection.h" namespace "freud::environment":
+cdef extern from "LocalBondProjection.h" namespace "freud::environment" nogil:
     cdef cppclass LocalBondProjection:
         LocalBondProjection()
         void compute(const freud._locality.NeighborQuery*, quat[float]*,
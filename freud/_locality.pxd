@@ -11,7 +11,7 @@ cimport freud.util
 from freud.util cimport vec3
 
 
-cdef extern from "NeighborBond.h" namespace "freud::locality":
+cdef extern from "NeighborBond.h" namespace "freud::locality" nogil:
     cdef cppclass NeighborBond:
         unsigned int query_point_idx
         unsigned int point_idx
@@ -21,7 +21,7 @@ cdef extern from "NeighborBond.h" namespace "freud::locality":
         bool operator!=(NeighborBond)
         bool operator<(NeighborBond)
 
-cdef extern from "NeighborQuery.h" namespace "freud::locality":
+cdef extern from "NeighborQuery.h" namespace "freud::locality" nogil:
 
     ctypedef enum QueryType "freud::locality::QueryType":
         none "freud::locality::QueryType::none"
@@ -36,6 +36,7 @@ cdef extern from "NeighborQuery.h" namespace "freud::locality":
         float r_guess
         float scale
         bool exclude_ii
+        bool half_list
 
     cdef cppclass NeighborQuery:
         NeighborQuery() except +
@@ -59,7 +60,7 @@ cdef extern from "NeighborQuery.h" namespace "freud::locality":
         NeighborBond next()
         NeighborList *toNeighborList(bool)
 
-cdef extern from "RawPoints.h" namespace "freud::locality":
+cdef extern from "RawPoints.h" namespace "freud::locality" nogil:
 
     cdef cppclass RawPoints(NeighborQuery):
         RawPoints() except +
@@ -67,7 +68,7 @@ cdef extern from "RawPoints.h" namespace "freud::locality":
                   const vec3[float]*,
                   unsigned int) except +
 
-cdef extern from "NeighborList.h" namespace "freud::locality":
+cdef extern from "NeighborList.h" namespace "freud::locality" nogil:
     cdef cppclass NeighborList:
         NeighborList()
         NeighborList(unsigned int)
@@ -84,6 +85,7 @@ cdef extern from "NeighborList.h" namespace "freud::locality":
         unsigned int getNumBonds() const
         unsigned int getNumPoints() const
         unsigned int getNumQueryPoints() const
+        bool getHalfList() const
         void setNumBonds(unsigned int, unsigned int, unsigned int)
         unsigned int filter[Iterator](const Iterator) except +
         unsigned int filter_r(float, float) except +
@@ -94,7 +96,7 @@ cdef extern from "NeighborList.h" namespace "freud::locality":
         void copy(const NeighborList &)
         void validate(unsigned int, unsigned int) except +
 
-cdef extern from "LinkCell.h" namespace "freud::locality":
+cdef extern from "LinkCell.h" namespace "freud::locality" nogil:
     cdef cppclass LinkCell(NeighborQuery):
         LinkCell() except +
         LinkCell(const freud._box.Box &,
@@ -103,14 +105,16 @@ cdef extern from "LinkCell.h" namespace "freud::locality":
                  float) except +
         float getCellWidth() const
 
-cdef extern from "AABBQuery.h" namespace "freud::locality":
+cdef extern from "AABBQuery.h" namespace "freud::locality" nogil:
     cdef cppclass AABBQuery(NeighborQuery):
         AABBQuery() except +
         AABBQuery(const freud._box.Box,
                   const vec3[float]*,
                   unsigned int) except +
+        bool updatePoints(const vec3[float]*, unsigned int,
+                          float) except +
 
-cdef extern from "BondHistogramCompute.h" namespace "freud::locality":
+cdef extern from "BondHistogramCompute.h" namespace "freud::locality" nogil:
     cdef cppclass BondHistogramCompute:
         BondHistogramCompute()
 
@@ -122,7 +126,7 @@ cdef extern from "BondHistogramCompute.h" namespace "freud::locality":
         vector[pair[float, float]] getBounds() const
         vector[size_t] getAxisSizes() const
 
-cdef extern from "PeriodicBuffer.h" namespace "freud::locality":
+cdef extern from "PeriodicBuffer.h" namespace "freud::locality" nogil:
     cdef cppclass PeriodicBuffer:
         PeriodicBuffer()
         const freud._box.Box & getBox() const
@@ -134,10 +138,24 @@ cdef extern from "PeriodicBuffer.h" namespace "freud::locality":
         vector[vec3[float]] getBufferPoints() const
         vector[uint] getBufferIds() const
 
-cdef extern from "Voronoi.h" namespace "freud::locality":
+cdef extern from "Voronoi.h" namespace "freud::locality" nogil:
     cdef cppclass Voronoi:
         Voronoi()
-        void compute(const NeighborQuery*) nogil except +
+        void compute(const NeighborQuery*) except +
         vector[vector[vec3[double]]] getPolytopes() const
         const freud.util.ManagedArray[double] &getVolumes() const
         shared_ptr[NeighborList] getNeighborList() const
+
+cdef extern from "VerletList.h" namespace "freud::locality" nogil:
+    cdef cppclass VerletList:
+        VerletList(float, float, float, bool) except +
+        void compute(const NeighborQuery*, const vec3[float]*,
+                     unsigned int) except +
+        void reset()
+        shared_ptr[NeighborList] getNeighborList() const
+        float getRMax() const
+        float getSkin() const
+        float getRMin() const
+        bool getExcludeII() const
+        bool getRebuilt() const
+        unsigned int getNumBuilds() const
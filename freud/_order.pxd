@@ -11,7 +11,7 @@ cimport freud.util
 from freud.util cimport quat, vec3
 
 
-cdef extern from "Cubatic.h" namespace "freud::order":
+cdef extern from "Cubatic.h" namespace "freud::order" nogil:
     cdef cppclass Cubatic:
         Cubatic(float,
                 float,
@@ -34,7 +34,7 @@ cdef extern from "Cubatic.h" namespace "freud::order":
         unsigned int getSeed() const
 
 
-cdef extern from "Nematic.h" namespace "freud::order":
+cdef extern from "Nematic.h" namespace "freud::order" nogil:
     cdef cppclass Nematic:
         Nematic(vec3[float])
         void reset()
@@ -48,14 +48,14 @@ cdef extern from "Nematic.h" namespace "freud::order":
         vec3[float] getU() const
 
 
-cdef extern from "HexaticTranslational.h" namespace "freud::order":
+cdef extern from "HexaticTranslational.h" namespace "freud::order" nogil:
     cdef cppclass Hexatic:
-        Hexatic(unsigned int, bool)
+        Hexatic(vector[unsigned int], bool) except +
         void compute(const freud._locality.NeighborList*,
                      const freud._locality.NeighborQuery*,
                      freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[float complex] &getOrder()
-        unsigned int getK()
+        vector[unsigned int] getK()
         bool isWeighted() const
 
     cdef cppclass Translational:
@@ -68,24 +68,24 @@ cdef extern from "HexaticTranslational.h" namespace "freud::order":
         bool isWeighted() const
 
 
-cdef extern from "Steinhardt.h" namespace "freud::order":
+cdef extern from "Steinhardt.h" namespace "freud::order" nogil:
     cdef cppclass Steinhardt:
-        Steinhardt(unsigned int, bool, bool, bool, bool) except +
+        Steinhardt(vector[unsigned int], bool, bool, bool, bool) except +
         unsigned int getNP() const
         void compute(const freud._locality.NeighborList*,
                      const freud._locality.NeighborQuery*,
                      freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[float] &getQl() const
         const freud.util.ManagedArray[float] &getParticleOrder() const
-        float getOrder() const
+        const vector[float] &getOrder() const
         bool isAverage() const
         bool isWl() const
         bool isWeighted() const
         bool isWlNormalized() const
-        unsigned int getL() const
+        const vector[unsigned int] &getL() const
 
 
-cdef extern from "SolidLiquid.h" namespace "freud::order":
+cdef extern from "SolidLiquid.h" namespace "freud::order" nogil:
     cdef cppclass SolidLiquid:
         SolidLiquid(unsigned int, float, unsigned int, bool) except +
         unsigned int getL() const
@@ -94,7 +94,7 @@ cdef extern from "SolidLiquid.h" namespace "freud::order":
         bool getNormalizeQ() const
         void compute(const freud._locality.NeighborList*,
                      const freud._locality.NeighborQuery*,
-                     freud._locality.QueryArgs) nogil except +
+                     freud._locality.QueryArgs) except +
         unsigned int getLargestClusterSize() const
         vector[unsigned int] getClusterSizes() const
         const freud.util.ManagedArray[unsigned int] &getClusterIdx() const
@@ -105,11 +105,19 @@ cdef extern from "SolidLiquid.h" namespace "freud::order":
         const freud.util.ManagedArray[float] &getQlij() const
 
 
-cdef extern from "RotationalAutocorrelation.h" namespace "freud::order":
+cdef extern from "RotationalAutocorrelation.h" namespace "freud::order" nogil:
     cdef cppclass RotationalAutocorrelation:
         RotationalAutocorrelation()
-        RotationalAutocorrelation(unsigned int)
-        unsigned int getL() const
+        RotationalAutocorrelation(vector[unsigned int], unsigned int,
+                                  unsigned int) except +
+        const vector[unsigned int] &getL() const
+        unsigned int getMaxLag() const
+        unsigned int getOriginInterval() const
         const freud.util.ManagedArray[float complex] &getRAArray() const
-        float getRotationalAutocorrelation() const
+        const vector[float] &getRotationalAutocorrelation() const
         void compute(quat[float]*, quat[float]*, unsigned int) except +
+        void reset()
+        void accumulate(quat[float]*, unsigned int) except +
+        unsigned int getNumFrames() const
+        const freud.util.ManagedArray[float] &getCorrelation() const
+        const freud.util.ManagedArray[unsigned int] &getNumOrigins() const
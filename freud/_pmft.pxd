@@ -7,12 +7,12 @@ from freud._locality cimport BondHistogramCompute
 from freud.util cimport quat, vec3
 
 
-cdef extern from "PMFT.h" namespace "freud::pmft":
+cdef extern from "PMFT.h" namespace "freud::pmft" nogil:
     cdef cppclass PMFT(BondHistogramCompute):
         PMFT() except +
         const freud.util.ManagedArray[float] &getPCF()
 
-cdef extern from "PMFTR12.h" namespace "freud::pmft":
+cdef extern from "PMFTR12.h" namespace "freud::pmft" nogil:
     cdef cppclass PMFTR12(PMFT):
         PMFTR12(float, unsigned int, unsigned int, unsigned int) except +
 
@@ -24,7 +24,7 @@ cdef extern from "PMFTR12.h" namespace "freud::pmft":
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
 
-cdef extern from "PMFTXYT.h" namespace "freud::pmft":
+cdef extern from "PMFTXYT.h" namespace "freud::pmft" nogil:
     cdef cppclass PMFTXYT(PMFT):
         PMFTXYT(float, float,
                 unsigned int, unsigned int, unsigned int) except +
@@ -37,7 +37,7 @@ cdef extern from "PMFTXYT.h" namespace "freud::pmft":
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
 
-cdef extern from "PMFTXY.h" namespace "freud::pmft":
+cdef extern from "PMFTXY.h" namespace "freud::pmft" nogil:
     cdef cppclass PMFTXY(PMFT):
         PMFTXY(float, float, unsigned int, unsigned int) except +
 
@@ -48,7 +48,7 @@ cdef extern from "PMFTXY.h" namespace "freud::pmft":
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
 
-cdef extern from "PMFTXYZ.h" namespace "freud::pmft":
+cdef extern from "PMFTXYZ.h" namespace "freud::pmft" nogil:
     cdef cppclass PMFTXYZ(PMFT):
         PMFTXYZ(float, float, float, unsigned int, unsigned int,
                 unsigned int, vec3[float]) except +
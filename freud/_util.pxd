@@ -6,7 +6,7 @@ from libcpp cimport bool
 from libcpp.vector cimport vector
 
 
-cdef extern from "VectorMath.h":
+cdef extern from "VectorMath.h" nogil:
     cdef cppclass vec3[Real]:
         vec3(Real, Real, Real)
         vec3()
@@ -20,7 +20,7 @@ cdef extern from "VectorMath.h":
         Real s
         vec3[Real] v
 
-cdef extern from "ManagedArray.h" namespace "freud::util":
+cdef extern from "ManagedArray.h" namespace "freud::util" nogil:
     cdef cppclass ManagedArray[T]:
         ManagedArray()
         ManagedArray(const ManagedArray[T] &)
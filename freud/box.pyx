@@ -199,7 +199,8 @@ cdef class Box:
 
         cdef const float[:, ::1] l_points = fractions
         cdef unsigned int Np = l_points.shape[0]
-        self.thisptr.makeAbsolute(<vec3[float]*> &l_points[0, 0], Np)
+        with nogil:
+            self.thisptr.makeAbsolute(<vec3[float]*> &l_points[0, 0], Np)
 
         return np.squeeze(fractions) if flatten else fractions
 
@@ -221,7 +222,8 @@ cdef class Box:
 
         cdef const float[:, ::1] l_points = vecs
         cdef unsigned int Np = l_points.shape[0]
-        self.thisptr.makeFractional(<vec3[float]*> &l_points[0, 0], Np)
+        with nogil:
+            self.thisptr.makeFractional(<vec3[float]*> &l_points[0, 0], Np)
 
         return np.squeeze(vecs) if flatten else vecs
 
@@ -245,8 +247,9 @@ cdef class Box:
         cdef const float[:, ::1] l_points = vecs
         cdef const int[:, ::1] l_result = images
         cdef unsigned int Np = l_points.shape[0]
-        self.thisptr.getImages(<vec3[float]*> &l_points[0, 0], Np,
-                               <vec3[int]*> &l_result[0, 0])
+        with nogil:
+            self.thisptr.getImages(<vec3[float]*> &l_points[0, 0], Np,
+                                   <vec3[int]*> &l_result[0, 0])
 
         return np.squeeze(images) if flatten else images
 
@@ -304,7 +307,8 @@ cdef class Box:
 
         cdef const float[:, ::1] l_points = vecs
         cdef unsigned int Np = l_points.shape[0]
-        self.thisptr.wrap(<vec3[float]*> &l_points[0, 0], Np)
+        with nogil:
+            self.thisptr.wrap(<vec3[float]*> &l_points[0, 0], Np)
 
         return np.squeeze(vecs) if flatten else vecs
 
@@ -337,8 +341,9 @@ cdef class Box:
         cdef const float[:, ::1] l_points = vecs
         cdef const int[:, ::1] l_imgs = imgs
         cdef unsigned int Np = l_points.shape[0]
-        self.thisptr.unwrap(<vec3[float]*> &l_points[0, 0],
-                            <vec3[int]*> &l_imgs[0, 0], Np)
+        with nogil:
+            self.thisptr.unwrap(<vec3[float]*> &l_points[0, 0],
+                                <vec3[int]*> &l_imgs[0, 0], Np)
 
         return np.squeeze(vecs) if flatten else vecs
 
@@ -381,8 +386,10 @@ cdef class Box:
             l_masses_ptr = &l_masses[0]
 
         cdef size_t Np = l_points.shape[0]
-        cdef vec3[float] result = self.thisptr.centerOfMass(
-            <vec3[float]*> &l_points[0, 0], Np, l_masses_ptr)
+        cdef vec3[float] result
+        with nogil:
+            result = self.thisptr.centerOfMass(
+                <vec3[float]*> &l_points[0, 0], Np, l_masses_ptr)
         return np.asarray([result.x, result.y, result.z])
 
     def center(self, vecs, masses=None):
@@ -423,7 +430,8 @@ cdef class Box:
             l_masses_ptr = &l_masses[0]
 
         cdef size_t Np = l_points.shape[0]
-        self.thisptr.center(<vec3[float]*> &l_points[0, 0], Np, l_masses_ptr)
+        with nogil:
+            self.thisptr.center(<vec3[float]*> &l_points[0, 0], Np, l_masses_ptr)
         return vecs
 
     def compute_distances(self, query_points, points):
@@ -456,10 +464,11 @@ cdef class Box:
             float[::1] distances = np.empty(
                 n_query_points, dtype=np.float32)
 
-        self.thisptr.computeDistances(
-            <vec3[float]*> &l_query_points[0, 0], n_query_points,
-            <vec3[float]*> &l_points[0, 0], n_points,
-            <float *> &distances[0])
+        with nogil:
+            self.thisptr.computeDistances(
+                <vec3[float]*> &l_query_points[0, 0], n_query_points,
+                <vec3[float]*> &l_points[0, 0], n_points,
+                <float *> &distances[0])
         return np.asarray(distances)
 
     def compute_all_distances(self, query_points, points):
@@ -491,10 +500,11 @@ cdef class Box:
             float[:, ::1] distances = np.empty(
                 [n_query_points, n_points], dtype=np.float32)
 
-        self.thisptr.computeAllDistances(
-            <vec3[float]*> &l_query_points[0, 0], n_query_points,
-            <vec3[float]*> &l_points[0, 0], n_points,
-            <float *> &distances[0, 0])
+        with nogil:
+            self.thisptr.computeAllDistances(
+                <vec3[float]*> &l_query_points[0, 0], n_query_points,
+                <vec3[float]*> &l_points[0, 0], n_points,
+                <float *> &distances[0, 0])
 
         return np.asarray(distances)
 
@@ -538,9 +548,10 @@ cdef class Box:
             np.ones(n_all_points), dtype=bool)
         cdef cpp_bool[::1] l_contains_mask = contains_mask
 
-        self.thisptr.contains(
-            <vec3[float]*> &l_points[0, 0], n_all_points,
-            <cpp_bool*> &l_contains_mask[0])
+        with nogil:
+            self.thisptr.contains(
+                <vec3[float]*> &l_points[0, 0], n_all_points,
+                <cpp_bool*> &l_contains_mask[0])
 
         return np.array(l_contains_mask).astype(bool)
 
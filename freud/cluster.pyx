@@ -94,11 +94,12 @@ cdef class Cluster(_PairCompute):
                 keys, shape=(num_query_points, ), dtype=np.uint32)
             l_keys_ptr = &l_keys[0]
 
-        self.thisptr.compute(
-            nq.get_ptr(),
-            nlist.get_ptr(),
-            dereference(qargs.thisptr),
-            l_keys_ptr)
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(),
+                nlist.get_ptr(),
+                dereference(qargs.thisptr),
+                l_keys_ptr)
         return self
 
     @_Compute._computed_property
@@ -159,12 +160,27 @@ cdef class ClusterProperties(_Compute):
 
      - Center of mass
      - Gyration tensor
-     - Size (number of points)
+     - Size (number of points) and total mass
+     - Radius of gyration
+     - Relative shape anisotropy
 
     The center of mass for each cluster (properly handling periodic boundary
     conditions) can be accessed with :code:`centers` attribute.  The :math:`3
     \times 3` symmetric gyration tensors :math:`G` can be accessed with
     :code:`gyrations` attribute.
+
+    The points are sorted by cluster in parallel, and the properties of the
+    clusters are computed in parallel, with the points of large clusters
+    split across threads. Points may optionally be weighted by mass, in which
+    case the centers and gyration tensors are mass-weighted.
+
+    .. note::
+
+        Gyration tensors are computed from the displacements of the points
+        from their cluster center using the minimum image convention, so
+        they are only meaningful for clusters whose points all lie within
+        half of the box length of their center, i.e. clusters less than one
+        box length wide.
     """
 
     cdef freud._cluster.ClusterProperties * thisptr
@@ -178,7 +194,7 @@ cdef class ClusterProperties(_Compute):
     def __dealloc__(self):
         del self.thisptr
 
-    def compute(self, system, cluster_idx):
+    def compute(self, system, cluster_idx, masses=None):
         R"""Compute properties of the point clusters.
         Loops over all points in the given array and determines the center of
         mass of the cluster as well as the gyration tensor. After calling
@@ -204,15 +220,28 @@ cdef class ClusterProperties(_Compute):
                 :class:`freud.locality.NeighborQuery.from_system`.
             cluster_idx ((:math:`N_{points}`,) :class:`np.ndarray`):
                 Cluster indexes for each point.
+            masses ((:math:`N_{points}`,) :class:`np.ndarray`, optional):
+                Masses corresponding to each point, defaulting to 1 if not
+                provided or :code:`None` (Default value = :code:`None`).
         """
         cdef freud.locality.NeighborQuery nq = \
             freud.locality.NeighborQuery.from_system(system)
         cluster_idx = freud.util._convert_array(
             cluster_idx, shape=(nq.points.shape[0], ), dtype=np.uint32)
         cdef const unsigned int[::1] l_cluster_idx = cluster_idx
-        self.thisptr.compute(
-            nq.get_ptr(),
-            <unsigned int*> &l_cluster_idx[0])
+
+        cdef float* l_masses_ptr = NULL
+        cdef float[::1] l_masses
+        if masses is not None:
+            l_masses = freud.util._convert_array(
+                masses, shape=(nq.points.shape[0], ))
+            l_masses_ptr = &l_masses[0]
+
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(),
+                <unsigned int*> &l_cluster_idx[0],
+                l_masses_ptr)
         return self
 
     @_Compute._computed_property
@@ -234,8 +263,22 @@ cdef class ClusterProperties(_Compute):
     @_Compute._computed_property
     def radii_of_gyration(self):
         """(:math:`N_{clusters}`,) :class:`numpy.ndarray`: The radius of
-        gyration of each cluster."""
-        return np.sqrt(np.trace(self.gyrations, axis1=-2, axis2=-1))
+        gyration of each cluster, the square root of the trace of its gyration
+        tensor."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterRadiiOfGyration(),
+            freud.util.arr_type_t.FLOAT)
+
+    @_Compute._computed_property
+    def shape_anisotropies(self):
+        R"""(:math:`N_{clusters}`,) :class:`numpy.ndarray`: The relative
+        shape anisotropy :math:`\kappa^2 = 1 - 3 I_2 / I_1^2` of each cluster,
+        where :math:`I_1` and :math:`I_2` are the first and second invariants
+        of its gyration tensor. It is 0 for spherically symmetric clusters and
+        1 for clusters whose points lie on a line."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterAnisotropies(),
+            freud.util.arr_type_t.FLOAT)
 
     @_Compute._computed_property
     def sizes(self):
@@ -244,5 +287,150 @@ cdef class ClusterProperties(_Compute):
             &self.thisptr.getClusterSizes(),
             freud.util.arr_type_t.UNSIGNED_INT)
 
+    @_Compute._computed_property
+    def masses(self):
+        """(:math:`N_{clusters}`) :class:`numpy.ndarray`: The total mass of
+        each cluster, equal to its size if no masses were provided."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterMasses(),
+            freud.util.arr_type_t.FLOAT)
+
     def __repr__(self):
         return "freud.cluster.{cls}()".format(cls=type(self).__name__)
+
+
+cdef class ClusterTracker(_PairCompute):
+    R"""Tracks clusters of points across the frames of a trajectory.
+
+    Every frame is clustered like :class:`~.Cluster`. Clusters with at least
+    :code:`min_size` points are tracked and receive persistent ids that carry
+    over between frames, which is useful for following nucleation and growth
+    over long trajectories. The points must be the same in every frame, so
+    the clusters of consecutive frames are matched by the number of points
+    they share. A cluster keeps the id of a cluster in the previous frame if
+    each is the other's largest overlap. All other tracked clusters receive
+    new ids.
+
+    Starting with the second frame, :code:`events` lists the births, deaths,
+    merges and splits of tracked clusters since the previous frame:
+
+    * :code:`('birth', None, id)`: A cluster that shares no points with any
+      cluster tracked in the previous frame.
+    * :code:`('death', id, None)`: A previously tracked cluster that shares no
+      points with any tracked cluster.
+    * :code:`('merge', previous_id, id)`: One event for every previous
+      cluster that overlaps a cluster formed by merging several clusters.
+    * :code:`('split', previous_id, id)`: One event for every cluster that
+      overlaps a previous cluster that split into several clusters.
+
+    .. note::
+
+        Clusters that fall below :code:`min_size` are no longer tracked, so
+        a tracked cluster that shrinks below :code:`min_size` dies.
+
+    Args:
+        min_size (unsigned int, optional):
+            Minimum number of points in a tracked cluster (Default value =
+            :code:`1`).
+    """
+
+    cdef freud._cluster.ClusterTracker * thisptr
+
+    def __cinit__(self, unsigned int min_size=1):
+        self.thisptr = new freud._cluster.ClusterTracker(min_size)
+
+    def __dealloc__(self):
+        del self.thisptr
+
+    def compute(self, system, neighbors=None):
+        R"""Compute the clusters of the next frame and match them to the
+        clusters of the previous frame.
+
+        Args:
+            system:
+                Any object that is a valid argument to
+                :class:`freud.locality.NeighborQuery.from_system`.
+            neighbors (:class:`freud.locality.NeighborList` or dict, optional):
+                Either a :class:`NeighborList <freud.locality.NeighborList>` of
+                neighbor pairs to use in the calculation, or a dictionary of
+                `query arguments
+                <https://freud.readthedocs.io/en/stable/topics/querying.html>`_
+                (Default value: None).
+        """
+        cdef:
+            freud.locality.NeighborQuery nq
+            freud.locality.NeighborList nlist
+            freud.locality._QueryArgs qargs
+            const float[:, ::1] l_query_points
+            unsigned int num_query_points
+
+        nq, nlist, qargs, l_query_points, num_query_points = \
+            self._preprocess_arguments(system, neighbors=neighbors)
+
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr))
+        return self
+
+    def reset(self):
+        R"""Forget the previous frame, so that the next call to
+        :meth:`compute` starts a new trajectory and new ids."""
+        self.thisptr.reset()
+
+    @property
+    def min_size(self):
+        """unsigned int: Minimum number of points in a tracked cluster."""
+        return self.thisptr.getMinSize()
+
+    @property
+    def num_frames(self):
+        """unsigned int: Number of frames computed since construction or the
+        last call to :meth:`reset`."""
+        return self.thisptr.getNumFrames()
+
+    @_Compute._computed_property
+    def num_clusters(self):
+        """int: The number of clusters in the current frame."""
+        return self.thisptr.getNumClusters()
+
+    @_Compute._computed_property
+    def cluster_idx(self):
+        """(:math:`N_{points}`) :class:`numpy.ndarray`: The cluster index for
+        each point in the current frame, as computed by :class:`~.Cluster`.
+        Clusters are sorted by size, so the tracked clusters have the
+        indices :code:`0` to :code:`len(cluster_ids) - 1`."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterIdx(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
+    @_Compute._computed_property
+    def cluster_ids(self):
+        """(:math:`N_{tracked}`) :class:`numpy.ndarray`: The persistent id of
+        each tracked cluster in the current frame."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterIds(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
+    @_Compute._computed_property
+    def events(self):
+        """list(tuple): The events since the previous frame as
+        :code:`(type, previous_id, id)` tuples."""
+        names = {
+            freud._cluster.birth: 'birth',
+            freud._cluster.death: 'death',
+            freud._cluster.merge: 'merge',
+            freud._cluster.split: 'split',
+        }
+        events = []
+        for event in self.thisptr.getEvents():
+            events.append((
+                names[event.type],
+                None if event.type == freud._cluster.birth
+                else event.previous_id,
+                None if event.type == freud._cluster.death
+                else event.current_id))
+        return events
+
+    def __repr__(self):
+        return "freud.cluster.{cls}(min_size={min_size})".format(
+            cls=type(self).__name__, min_size=self.min_size)
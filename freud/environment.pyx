@@ -17,6 +17,7 @@ from freud.errors import NO_DEFAULT_QUERY_ARGS_MESSAGE
 
 cimport numpy as np
 from cython.operator cimport dereference
+from libcpp cimport bool as cbool
 from libcpp.map cimport map
 
 cimport freud._environment
@@ -189,13 +190,14 @@ cdef class BondOrder(_SpatialHistogram):
         cdef const float[:, ::1] l_orientations = orientations
         cdef const float[:, ::1] l_query_orientations = query_orientations
 
-        self.thisptr.accumulate(
-            nq.get_ptr(),
-            <quat[float]*> &l_orientations[0, 0],
-            <vec3[float]*> &l_query_points[0, 0],
-            <quat[float]*> &l_query_orientations[0, 0],
-            num_query_points,
-            nlist.get_ptr(), dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.accumulate(
+                nq.get_ptr(),
+                <quat[float]*> &l_orientations[0, 0],
+                <vec3[float]*> &l_query_points[0, 0],
+                <quat[float]*> &l_query_orientations[0, 0],
+                num_query_points,
+                nlist.get_ptr(), dereference(qargs.thisptr))
         return self
 
     @_Compute._computed_property
@@ -275,7 +277,7 @@ cdef class LocalDescriptors(_PairCompute):
         del self.thisptr
 
     def compute(self, system, query_points=None, orientations=None,
-                neighbors=None, max_num_neighbors=0):
+                neighbors=None, unsigned int max_num_neighbors=0):
         R"""Calculates the local descriptors of bonds from a set of source
         points to a set of destination points.
 
@@ -326,12 +328,13 @@ cdef class LocalDescriptors(_PairCompute):
             l_orientations = orientations
             l_orientations_ptr = <quat[float]*> &l_orientations[0, 0]
 
-        self.thisptr.compute(
-            nq.get_ptr(),
-            <vec3[float]*> &l_query_points[0, 0], num_query_points,
-            l_orientations_ptr,
-            nlist.get_ptr(), dereference(qargs.thisptr),
-            max_num_neighbors)
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(),
+                <vec3[float]*> &l_query_points[0, 0], num_query_points,
+                l_orientations_ptr,
+                nlist.get_ptr(), dereference(qargs.thisptr),
+                max_num_neighbors)
         return self
 
     @_Compute._computed_property
@@ -524,9 +527,9 @@ cdef class EnvironmentCluster(_MatchEnv):
     def __dealloc__(self):
         del self.thisptr
 
-    def compute(self, system, threshold, neighbors=None,
-                env_neighbors=None, registration=False,
-                global_search=False):
+    def compute(self, system, float threshold, neighbors=None,
+                env_neighbors=None, cbool registration=False,
+                cbool global_search=False):
         R"""Determine clusters of particles with matching environments.
 
         In general, it is recommended to specify a number of neighbors rather
@@ -600,10 +603,11 @@ cdef class EnvironmentCluster(_MatchEnv):
             env_neighbors = neighbors
         env_nlist, env_qargs = self._resolve_neighbors(env_neighbors)
 
-        self.thisptr.compute(
-            nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr),
-            env_nlist.get_ptr(), dereference(env_qargs.thisptr), threshold,
-            registration, global_search)
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr),
+                env_nlist.get_ptr(), dereference(env_qargs.thisptr), threshold,
+                registration, global_search)
         return self
 
     @_Compute._computed_property
@@ -676,8 +680,8 @@ cdef class EnvironmentMotifMatch(_MatchEnv):
     def __init__(self):
         pass
 
-    def compute(self, system, motif, threshold, neighbors=None,
-                registration=False):
+    def compute(self, system, motif, float threshold, neighbors=None,
+                cbool registration=False):
         R"""Determine clusters of particles that match the motif provided by
         motif.
 
@@ -718,11 +722,12 @@ cdef class EnvironmentMotifMatch(_MatchEnv):
         cdef const float[:, ::1] l_motif = motif
         cdef unsigned int nRef = l_motif.shape[0]
 
-        self.thisptr.compute(
-            nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr),
-            <vec3[float]*>
-            <vec3[float]*> &l_motif[0, 0], nRef,
-            threshold, registration)
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr),
+                <vec3[float]*>
+                <vec3[float]*> &l_motif[0, 0], nRef,
+                threshold, registration)
 
     @_Compute._computed_property
     def matches(self):
@@ -757,7 +762,7 @@ cdef class _EnvironmentRMSDMinimizer(_MatchEnv):
         pass
 
     def compute(self, system, motif, neighbors=None,
-                registration=False):
+                cbool registration=False):
         R"""Rotate (if registration=True) and permute the environments of all
         particles to minimize their RMSD with respect to the motif provided by
         motif.
@@ -798,11 +803,12 @@ cdef class _EnvironmentRMSDMinimizer(_MatchEnv):
         cdef const float[:, ::1] l_motif = motif
         cdef unsigned int nRef = l_motif.shape[0]
 
-        self.thisptr.compute(
-            nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr),
-            <vec3[float]*>
-            <vec3[float]*> &l_motif[0, 0], nRef,
-            registration)
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(), nlist.get_ptr(), dereference(qargs.thisptr),
+                <vec3[float]*>
+                <vec3[float]*> &l_motif[0, 0], nRef,
+                registration)
 
         return self
 
@@ -895,16 +901,17 @@ cdef class AngularSeparationNeighbor(_PairCompute):
 
         cdef unsigned int n_equiv_orientations = l_equiv_orientations.shape[0]
 
-        self.thisptr.compute(
-            nq.get_ptr(),
-            <quat[float]*> &l_orientations[0, 0],
-            <vec3[float]*> &l_query_points[0, 0],
-            <quat[float]*> &l_query_orientations[0, 0],
-            num_query_points,
-            <quat[float]*> &l_equiv_orientations[0, 0],
-            n_equiv_orientations,
-            nlist.get_ptr(),
-            dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(),
+                <quat[float]*> &l_orientations[0, 0],
+                <vec3[float]*> &l_query_points[0, 0],
+                <quat[float]*> &l_query_orientations[0, 0],
+                num_query_points,
+                <quat[float]*> &l_equiv_orientations[0, 0],
+                n_equiv_orientations,
+                nlist.get_ptr(),
+                dereference(qargs.thisptr))
         return self
 
     @_Compute._computed_property
@@ -978,13 +985,14 @@ cdef class AngularSeparationGlobal(_Compute):
         cdef unsigned int n_points = l_orientations.shape[0]
         cdef unsigned int n_equiv_orientations = l_equiv_orientations.shape[0]
 
-        self.thisptr.compute(
-            <quat[float]*> &l_global_orientations[0, 0],
-            n_global,
-            <quat[float]*> &l_orientations[0, 0],
-            n_points,
-            <quat[float]*> &l_equiv_orientations[0, 0],
-            n_equiv_orientations)
+        with nogil:
+            self.thisptr.compute(
+                <quat[float]*> &l_global_orientations[0, 0],
+                n_global,
+                <quat[float]*> &l_orientations[0, 0],
+                n_points,
+                <quat[float]*> &l_equiv_orientations[0, 0],
+                n_equiv_orientations)
         return self
 
     @_Compute._computed_property
@@ -1081,13 +1089,14 @@ cdef class LocalBondProjection(_PairCompute):
         cdef unsigned int n_equiv = l_equiv_orientations.shape[0]
         cdef unsigned int n_proj = l_proj_vecs.shape[0]
 
-        self.thisptr.compute(
-            nq.get_ptr(),
-            <quat[float]*> &l_orientations[0, 0],
-            <vec3[float]*> &l_query_points[0, 0], num_query_points,
-            <vec3[float]*> &l_proj_vecs[0, 0], n_proj,
-            <quat[float]*> &l_equiv_orientations[0, 0], n_equiv,
-            nlist.get_ptr(), dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(),
+                <quat[float]*> &l_orientations[0, 0],
+                <vec3[float]*> &l_query_points[0, 0], num_query_points,
+                <vec3[float]*> &l_proj_vecs[0, 0], n_proj,
+                <quat[float]*> &l_equiv_orientations[0, 0], n_equiv,
+                nlist.get_ptr(), dereference(qargs.thisptr))
         return self
 
     @_Compute._computed_property
@@ -35,13 +35,13 @@ cdef class NeighborQueryResult:
 cdef class NeighborQuery:
     cdef freud._locality.NeighborQuery * nqptr
     cdef const float[:, ::1] points
-    cdef freud._locality.NeighborQuery * get_ptr(self)
+    cdef freud._locality.NeighborQuery * get_ptr(self) nogil
 
 cdef class NeighborList:
     cdef freud._locality.NeighborList * thisptr
     cdef char _managed
 
-    cdef freud._locality.NeighborList * get_ptr(self)
+    cdef freud._locality.NeighborList * get_ptr(self) nogil
     cdef void copy_c(self, NeighborList other)
 
 cdef class LinkCell(NeighborQuery):
@@ -73,3 +73,7 @@ cdef class Voronoi(_Compute):
     cdef freud._locality.Voronoi * thisptr
     cdef NeighborList _nlist
     cdef freud.box.Box _box
+
+cdef class VerletList(_Compute):
+    cdef freud._locality.VerletList * thisptr
+    cdef NeighborList _nlist
@@ -39,7 +39,7 @@ cdef class _QueryArgs:
 
     def __cinit__(self, mode=None, r_min=None, r_max=None, r_guess=None,
                   num_neighbors=None, exclude_ii=None,
-                  scale=None, **kwargs):
+                  scale=None, half_list=None, **kwargs):
         if type(self) == _QueryArgs:
             self.thisptr = new freud._locality.QueryArgs()
             self.mode = mode
@@ -55,6 +55,8 @@ cdef class _QueryArgs:
                 self.exclude_ii = exclude_ii
             if scale is not None:
                 self.scale = scale
+            if half_list is not None:
+                self.half_list = half_list
             if len(kwargs):
                 err_str = ", ".join(
                     "{} = {}".format(k, v) for k, v in kwargs.items())
@@ -151,6 +153,14 @@ cdef class _QueryArgs:
     def scale(self, value):
         self.thisptr.scale = value
 
+    @property
+    def half_list(self):
+        return self.thisptr.half_list
+
+    @half_list.setter
+    def half_list(self, value):
+        self.thisptr.half_list = value
+
     def __repr__(self):
         return ("freud.locality.{cls}(mode={mode}, r_max={r_max}, "
                 "num_neighbors={num_neighbors}, exclude_ii={exclude_ii}, "
@@ -214,14 +224,16 @@ cdef class NeighborQueryResult:
             neighbor pairs found by the query generating this result object.
         """
         cdef const float[:, ::1] l_points = self.points
-        cdef shared_ptr[freud._locality.NeighborQueryIterator] iterator = \
-            self.nq.nqptr.query(
-                <vec3[float]*> &l_points[0, 0],
-                self.points.shape[0],
+        cdef unsigned int num_points = l_points.shape[0]
+        cdef cbool c_sort_by_distance = sort_by_distance
+        cdef shared_ptr[freud._locality.NeighborQueryIterator] iterator
+        cdef freud._locality.NeighborList *cnlist
+
+        with nogil:
+            iterator = self.nq.nqptr.query(
+                <vec3[float]*> &l_points[0, 0], num_points,
                 dereference(self.query_args.thisptr))
-
-        cdef freud._locality.NeighborList *cnlist = dereference(
-            iterator).toNeighborList(sort_by_distance)
+            cnlist = dereference(iterator).toNeighborList(c_sort_by_distance)
         cdef NeighborList nl = _nlist_from_cnlist(cnlist)
         # Explicitly manage a manually created nlist so that it will be
         # deleted when the Python object is.
@@ -400,9 +412,13 @@ cdef class NeighborQuery:
             np.atleast_2d(query_points), shape=(None, 3))
 
         cdef _QueryArgs args = _QueryArgs.from_dict(query_args)
+        # Half lists are only found for the points themselves, which may have
+        # been passed as an equal array with a different dtype or layout.
+        if args.half_list and np.array_equal(query_points, self.points):
+            query_points = self.points
         return NeighborQueryResult.init(self, query_points, args)
 
-    cdef freud._locality.NeighborQuery * get_ptr(self):
+    cdef freud._locality.NeighborQuery * get_ptr(self) nogil:
         R"""Returns a pointer to the raw C++ object we are wrapping."""
         return self.nqptr
 
@@ -443,9 +459,9 @@ cdef class NeighborList:
     For efficiency, all bonds must be sorted by the query point index, from
     least to greatest. Bonds have an query point index :math:`i` and a point
     index :math:`j`. The first bond index corresponding to a given query point
-    can be found in :math:`\log(N_{bonds})` time using
-    :meth:`find_first_index`, because bonds are ordered by the query point
-    index.
+    can be found in constant time using :meth:`find_first_index`, because
+    bonds are ordered by the query point index and the offsets of each query
+    point's bonds are stored in compressed sparse row form.
 
     .. note::
 
@@ -559,7 +575,7 @@ cdef class NeighborList:
         if self._managed:
             del self.thisptr
 
-    cdef freud._locality.NeighborList * get_ptr(self):
+    cdef freud._locality.NeighborList * get_ptr(self) nogil:
         R"""Returns a pointer to the raw C++ object we are wrapping."""
         return self.thisptr
 
@@ -659,6 +675,17 @@ cdef class NeighborList:
         """
         return self.thisptr.getNumPoints()
 
+    @property
+    def half_list(self):
+        """bool: Whether this list stores each pair of neighbors only once.
+
+        Half lists are generated by self-queries with the query argument
+        :code:`half_list=True` and contain only bonds :math:`(i, j)` with
+        :math:`i < j`. Symmetric computes such as
+        :class:`freud.density.RDF` account for the omitted reverse bonds.
+        """
+        return self.thisptr.getHalfList()
+
     def find_first_index(self, unsigned int i):
         R"""Returns the lowest bond index corresponding to a query particle
         with an index :math:`\geq i`.
@@ -686,7 +713,8 @@ cdef class NeighborList:
         filt = np.ascontiguousarray(filt, dtype=bool)
         cdef np.ndarray[np.uint8_t, ndim=1, cast=True] filt_c = filt
         cdef const cbool * filt_ptr = <cbool*> &filt_c[0]
-        self.thisptr.filter(filt_ptr)
+        with nogil:
+            self.thisptr.filter(filt_ptr)
         return self
 
     def filter_r(self, float r_max, float r_min=0):
@@ -699,7 +727,8 @@ cdef class NeighborList:
                 Minimum bond distance in the resulting neighbor list
                 (Default value = :code:`0`).
         """
-        self.thisptr.filter_r(r_max, r_min)
+        with nogil:
+            self.thisptr.filter_r(r_max, r_min)
         return self
 
 
@@ -829,6 +858,7 @@ cdef class AABBQuery(NeighborQuery):
 
     def __cinit__(self, box, points):
         cdef const float[:, ::1] l_points
+        cdef unsigned int num_points
         cdef freud.box.Box b
         if type(self) is AABBQuery:
             # Assume valid set of arguments is passed
@@ -836,15 +866,50 @@ cdef class AABBQuery(NeighborQuery):
             self.points = freud.util._convert_array(
                 points, shape=(None, 3)).copy()
             l_points = self.points
-            self.thisptr = self.nqptr = new freud._locality.AABBQuery(
-                dereference(b.thisptr),
-                <vec3[float]*> &l_points[0, 0],
-                self.points.shape[0])
+            num_points = l_points.shape[0]
+            with nogil:
+                self.thisptr = new freud._locality.AABBQuery(
+                    dereference(b.thisptr),
+                    <vec3[float]*> &l_points[0, 0], num_points)
+            self.nqptr = self.thisptr
 
     def __dealloc__(self):
         if type(self) is AABBQuery:
             del self.thisptr
 
+    def update_points(self, points, float max_area_ratio=1.5):
+        R"""Update the points, refitting the existing tree when possible.
+
+        Rather than building a new tree, the bounding boxes of the existing
+        tree are refit to the new points, which is much faster when the points
+        have only moved slightly (e.g. between frames of a trajectory). The
+        tree is rebuilt from scratch if the number of points changes, or if
+        the quality of the refit tree (measured by the summed surface area of
+        its nodes) has degraded too much.
+
+        Args:
+            points ((:math:`N`, 3) :class:`numpy.ndarray`):
+                The new points.
+            max_area_ratio (float, optional):
+                The tree is rebuilt if its summed node surface area exceeds
+                this multiple of the surface area of the last built tree
+                (Default value = :code:`1.5`).
+
+        Returns:
+            bool: Whether the tree was rebuilt.
+        """
+        cdef const float[:, ::1] l_points
+        new_points = freud.util._convert_array(
+            points, shape=(None, 3)).copy()
+        l_points = new_points
+        cdef unsigned int num_points = l_points.shape[0]
+        cdef cbool rebuilt
+        with nogil:
+            rebuilt = self.thisptr.updatePoints(
+                <vec3[float]*> &l_points[0, 0], num_points, max_area_ratio)
+        self.points = new_points
+        return rebuilt
+
 
 cdef class LinkCell(NeighborQuery):
     R"""Supports efficiently finding all points in a set within a certain
@@ -866,13 +931,16 @@ cdef class LinkCell(NeighborQuery):
     def __cinit__(self, box, points, cell_width=0):
         cdef freud.box.Box b = freud.util._convert_box(box)
         cdef const float[:, ::1] l_points
+        cdef float c_cell_width = cell_width
         self.points = freud.util._convert_array(
             points, shape=(None, 3)).copy()
         l_points = self.points
-        self.thisptr = self.nqptr = new freud._locality.LinkCell(
-            dereference(b.thisptr),
-            <vec3[float]*> &l_points[0, 0],
-            self.points.shape[0], cell_width)
+        cdef unsigned int num_points = l_points.shape[0]
+        with nogil:
+            self.thisptr = new freud._locality.LinkCell(
+                dereference(b.thisptr),
+                <vec3[float]*> &l_points[0, 0], num_points, c_cell_width)
+        self.nqptr = self.thisptr
 
     def __dealloc__(self):
         del self.thisptr
@@ -1106,7 +1174,8 @@ cdef class PeriodicBuffer(_Compute):
         else:
             raise ValueError('buffer must be a scalar or have length 3.')
 
-        self.thisptr.compute(nq.get_ptr(), buffer_vec, images)
+        with nogil:
+            self.thisptr.compute(nq.get_ptr(), buffer_vec, images)
         return self
 
     @_Compute._computed_property
@@ -1167,7 +1236,8 @@ cdef class Voronoi(_Compute):
                 :class:`freud.locality.NeighborQuery.from_system`.
         """
         cdef NeighborQuery nq = NeighborQuery.from_system(system)
-        self.thisptr.compute(nq.get_ptr())
+        with nogil:
+            self.thisptr.compute(nq.get_ptr())
         self._box = nq.box
         return self
 
@@ -1261,3 +1331,123 @@ cdef class Voronoi(_Compute):
             return freud.plot._ax_to_bytes(self.plot())
         except (AttributeError, ImportError):
             return None
+
+
+cdef class VerletList(_Compute):
+    R"""Reuse a buffered neighbor list across the frames of a trajectory.
+
+    The first call to :meth:`compute` finds all bonds with distances less than
+    :code:`r_max + skin`. On subsequent frames, only the distances of these
+    buffered bonds are recomputed and filtered down to :code:`r_max`, which is
+    much faster than performing a new neighbor query. The buffered bonds are
+    rebuilt once the largest displacement of any point plus the largest
+    displacement of any query point since the last build exceeds the skin
+    (for self-neighbor lists, once any point has moved farther than
+    :code:`skin / 2`), or when the box or number of points changes.
+
+    The computed neighbor list is identical to the result of a ball query with
+    the same :code:`r_max`, :code:`r_min`, and :code:`exclude_ii`.
+
+    Args:
+        r_max (float):
+            Maximum distance of the computed neighbor list.
+        skin (float):
+            Extra distance added to :code:`r_max` when building the buffered
+            list. Larger values lead to fewer rebuilds, but more bonds must be
+            filtered on every frame.
+        r_min (float, optional):
+            Minimum distance of the computed neighbor list
+            (Default value = :code:`0`).
+        exclude_ii (bool, optional):
+            Whether to exclude bonds between a point and the query point with
+            the same index, as is typical for self-neighbor lists
+            (Default value = :code:`False`).
+    """
+
+    def __cinit__(self, float r_max, float skin, float r_min=0,
+                  cbool exclude_ii=False):
+        self.thisptr = new freud._locality.VerletList(
+            r_max, skin, r_min, exclude_ii)
+        self._nlist = NeighborList()
+
+    def __dealloc__(self):
+        del self.thisptr
+
+    def compute(self, system, query_points=None):
+        R"""Compute the neighbor list of the current frame.
+
+        Args:
+            system:
+                Any object that is a valid argument to
+                :class:`freud.locality.NeighborQuery.from_system`.
+            query_points ((:math:`N_{query\_points}`, 3) :class:`numpy.ndarray`, optional):
+                Query points used to find bonds. Uses the system's points if
+                :code:`None` (Default value = :code:`None`).
+        """  # noqa E501
+        cdef NeighborQuery nq = NeighborQuery.from_system(system)
+        if query_points is None:
+            query_points = nq.points
+        else:
+            query_points = freud.util._convert_array(
+                query_points, shape=(None, 3))
+        cdef const float[:, ::1] l_query_points = query_points
+        cdef unsigned int num_query_points = l_query_points.shape[0]
+
+        with nogil:
+            self.thisptr.compute(
+                nq.get_ptr(), <vec3[float]*> &l_query_points[0, 0],
+                num_query_points)
+        return self
+
+    def reset(self):
+        R"""Force the buffered list to be rebuilt on the next call to
+        :meth:`compute`."""
+        self.thisptr.reset()
+
+    @property
+    def r_max(self):
+        """float: Maximum distance of the computed neighbor list."""
+        return self.thisptr.getRMax()
+
+    @property
+    def skin(self):
+        """float: Extra distance used when building the buffered list."""
+        return self.thisptr.getSkin()
+
+    @property
+    def r_min(self):
+        """float: Minimum distance of the computed neighbor list."""
+        return self.thisptr.getRMin()
+
+    @property
+    def exclude_ii(self):
+        """bool: Whether bonds between equal indices are excluded."""
+        return self.thisptr.getExcludeII()
+
+    @_Compute._computed_property
+    def rebuilt(self):
+        """bool: Whether the last call to :meth:`compute` rebuilt the buffered
+        list."""
+        return self.thisptr.getRebuilt()
+
+    @_Compute._computed_property
+    def num_builds(self):
+        """int: The number of times the buffered list has been built."""
+        return self.thisptr.getNumBuilds()
+
+    @_Compute._computed_property
+    def nlist(self):
+        R"""Returns the computed :class:`~.locality.NeighborList`.
+
+        Returns:
+            :class:`~.locality.NeighborList`: Neighbor list.
+        """
+        self._nlist = _nlist_from_cnlist(self.thisptr.getNeighborList().get())
+        return self._nlist
+
+    def __repr__(self):
+        return ("freud.locality.{cls}(r_max={r_max}, skin={skin}, "
+                "r_min={r_min}, exclude_ii={exclude_ii})").format(
+                    cls=type(self).__name__, r_max=self.r_max,
+                    skin=self.skin, r_min=self.r_min,
+                    exclude_ii=self.exclude_ii)
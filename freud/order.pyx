@@ -24,6 +24,7 @@ from freud.errors import FreudDeprecationWarning
 
 cimport numpy as np
 from cython.operator cimport dereference
+from libcpp.vector cimport vector
 
 cimport freud._order
 cimport freud.locality
@@ -38,25 +39,45 @@ np.import_array()
 
 cdef class Cubatic(_Compute):
     R"""Compute the cubatic order parameter :cite:`Haji_Akbari_2015` for a system of
-    particles using simulated annealing instead of Newton-Raphson root finding.
+    particles.
+
+    The cubatic orientation is found by maximizing the order parameter with
+    Newton's method on the group of rotations, starting from frames derived
+    from the eigenvectors of the global tensor. The result is deterministic
+    and the cost of the optimization does not depend on the number of
+    particles.
+
+    .. note::
+        Earlier versions of freud optimized the order parameter with replicate
+        runs of simulated annealing. The annealing parameters below are no
+        longer used, are only kept for backwards compatibility, and will be
+        removed in freud 3.0. Passing any of them with a value other than its
+        default raises a :class:`freud.errors.FreudDeprecationWarning`.
 
     Args:
-        t_initial (float):
-            Starting temperature.
-        t_final (float):
-            Final temperature.
-        scale (float):
-            Scaling factor to reduce temperature.
+        t_initial (float, optional):
+            Starting temperature (unused). (Default value = :code:`5.0`).
+        t_final (float, optional):
+            Final temperature (unused). (Default value = :code:`0.001`).
+        scale (float, optional):
+            Scaling factor to reduce temperature (unused).
+            (Default value = :code:`0.95`).
         n_replicates (unsigned int, optional):
-            Number of replicate simulated annealing runs.
+            Number of replicate simulated annealing runs (unused).
             (Default value = :code:`1`).
         seed (unsigned int, optional):
-            Random seed to use in calculations. If :code:`None`, system time is used.
+            Random seed (unused). If :code:`None`, system time is used.
             (Default value = :code:`None`).
     """  # noqa: E501
     cdef freud._order.Cubatic * thisptr
 
-    def __cinit__(self, t_initial, t_final, scale, n_replicates=1, seed=None):
+    def __cinit__(self, t_initial=5.0, t_final=0.001, scale=0.95, n_replicates=1,
+                  seed=None):
+        if (t_initial != 5.0 or t_final != 0.001 or scale != 0.95
+                or n_replicates != 1 or seed is not None):
+            warnings.warn("The t_initial, t_final, scale, n_replicates and "
+                          "seed arguments of Cubatic are unused and will be "
+                          "removed in version 3.0", FreudDeprecationWarning)
         if seed is None:
             seed = int(time.time())
 
@@ -79,33 +100,35 @@ cdef class Cubatic(_Compute):
         cdef const float[:, ::1] l_orientations = orientations
         cdef unsigned int num_particles = l_orientations.shape[0]
 
-        self.thisptr.compute(
-            <quat[float]*> &l_orientations[0, 0], num_particles)
+        with nogil:
+            self.thisptr.compute(
+                <quat[float]*> &l_orientations[0, 0], num_particles)
         return self
 
     @property
     def t_initial(self):
-        """float: The value of the initial temperature."""
+        """float: The value of the initial temperature (unused)."""
         return self.thisptr.getTInitial()
 
     @property
     def t_final(self):
-        """float: The value of the final temperature."""
+        """float: The value of the final temperature (unused)."""
         return self.thisptr.getTFinal()
 
     @property
     def scale(self):
-        """float: The scale."""
+        """float: The scale (unused)."""
         return self.thisptr.getScale()
 
     @property
     def n_replicates(self):
-        """unsigned int: Number of replicate simulated annealing runs."""
+        """unsigned int: Number of replicate simulated annealing runs
+        (unused)."""
         return self.thisptr.getNReplicates()
 
     @property
     def seed(self):
-        """unsigned int: Random seed to use in calculations."""
+        """unsigned int: Random seed (unused)."""
         return self.thisptr.getSeed()
 
     @_Compute._computed_property
@@ -198,8 +221,9 @@ cdef class Nematic(_Compute):
         cdef const float[:, ::1] l_orientations = orientations
         cdef unsigned int num_particles = l_orientations.shape[0]
 
-        self.thisptr.compute(<quat[float]*> &l_orientations[0, 0],
-                             num_particles)
+        with nogil:
+            self.thisptr.compute(<quat[float]*> &l_orientations[0, 0],
+                                 num_particles)
         return self
 
     @_Compute._computed_property
@@ -261,6 +285,11 @@ cdef class Hexatic(_PairCompute):
     The quantity :math:`\phi_{ij}` is the angle between the
     vector :math:`r_{ij}` and :math:`\left(1, 0\right)`.
 
+    Several values of :math:`k` may be given, in which case the order
+    parameters for all of them are computed in a single pass over the
+    neighbors, and :attr:`particle_order` has one column per value of
+    :math:`k`.
+
     If the weighted mode is enabled, contributions of each neighbor are
     weighted. Neighbor weights :math:`w_j` default to 1 but are defined for a
     :class:`freud.locality.NeighborList` from :class:`freud.locality.Voronoi`
@@ -284,8 +313,9 @@ cdef class Hexatic(_PairCompute):
         The points must be passed in as :code:`[x, y, 0]`.
 
     Args:
-        k (unsigned int, optional):
-            Symmetry of order parameter (Default value = :code:`6`).
+        k (unsigned int or sequence of unsigned int, optional):
+            Symmetry of order parameter, or a sequence of symmetries to
+            compute together (Default value = :code:`6`).
         weighted (bool, optional):
             Determines whether to use neighbor weights in the computation of
             spherical harmonics over neighbors. If enabled and used with a
@@ -294,9 +324,12 @@ cdef class Hexatic(_PairCompute):
             :code:`False`).
     """  # noqa: E501
     cdef freud._order.Hexatic * thisptr
+    cdef bint _multiple_k
 
     def __cinit__(self, k=6, weighted=False):
-        self.thisptr = new freud._order.Hexatic(k, weighted)
+        self._multiple_k = np.ndim(k) != 0
+        cdef vector[unsigned int] ks = np.atleast_1d(k).tolist()
+        self.thisptr = new freud._order.Hexatic(ks, weighted)
 
     def __dealloc__(self):
         del self.thisptr
@@ -335,28 +368,35 @@ cdef class Hexatic(_PairCompute):
 
         nq, nlist, qargs, l_query_points, num_query_points = \
             self._preprocess_arguments(system, neighbors=neighbors)
-        self.thisptr.compute(nlist.get_ptr(),
-                             nq.get_ptr(), dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.compute(nlist.get_ptr(),
+                                 nq.get_ptr(), dereference(qargs.thisptr))
         return self
 
     @property
     def default_query_args(self):
         """The default query arguments are
-        :code:`{'mode': 'nearest', 'num_neighbors': self.k}`."""
-        return dict(mode="nearest", num_neighbors=self.k)
+        :code:`{'mode': 'nearest', 'num_neighbors': self.k}`, using the
+        largest value of :code:`k` if several were given."""
+        return dict(mode="nearest", num_neighbors=max(self.thisptr.getK()))
 
     @_Compute._computed_property
     def particle_order(self):
-        """:math:`\\left(N_{particles} \\right)` :class:`numpy.ndarray`: Order
-        parameter."""
-        return freud.util.make_managed_numpy_array(
+        """:math:`\\left(N_{particles} \\right)` or
+        :math:`\\left(N_{particles}, N_k \\right)` :class:`numpy.ndarray`:
+        Order parameter, with one column per :math:`k` if several were
+        given."""
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getOrder(),
             freud.util.arr_type_t.COMPLEX_FLOAT)
+        return array if self._multiple_k else array[:, 0]
 
     @property
     def k(self):
-        """unsigned int: Symmetry of the order parameter."""
-        return self.thisptr.getK()
+        """unsigned int or list[unsigned int]: Symmetry of the order
+        parameter, or a list of them if several were given."""
+        ks = list(self.thisptr.getK())
+        return ks if self._multiple_k else ks[0]
 
     @property
     def weighted(self):
@@ -379,16 +419,26 @@ cdef class Hexatic(_PairCompute):
             (:class:`matplotlib.axes.Axes`): Axis with the plot.
         """
         import freud.plot
-        xlabel = r"$\left|\psi{prime}_{k}\right|$".format(
-            prime='\'' if self.weighted else '',
-            k=self.k)
-
+        labels = [
+            r"$\left|\psi{prime}_{{{k}}}\right|$".format(
+                prime='\'' if self.weighted else '',
+                k=k)
+            for k in np.atleast_1d(self.k)]
+
+        if not self._multiple_k:
+            return freud.plot.histogram_plot(
+                np.absolute(self.particle_order),
+                title="Hexatic Order Parameter " + labels[0],
+                xlabel=labels[0],
+                ylabel=r"Number of particles",
+                ax=ax)
         return freud.plot.histogram_plot(
             np.absolute(self.particle_order),
-            title="Hexatic Order Parameter " + xlabel,
-            xlabel=xlabel,
+            title="Hexatic Order Parameter",
+            xlabel="Order parameter",
             ylabel=r"Number of particles",
-            ax=ax)
+            ax=ax,
+            legend_labels=labels)
 
     def _repr_png_(self):
         try:
@@ -458,8 +508,9 @@ cdef class Translational(_PairCompute):
         nq, nlist, qargs, l_query_points, num_query_points = \
             self._preprocess_arguments(system, neighbors=neighbors)
 
-        self.thisptr.compute(nlist.get_ptr(),
-                             nq.get_ptr(), dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.compute(nlist.get_ptr(),
+                                 nq.get_ptr(), dereference(qargs.thisptr))
         return self
 
     @property
@@ -474,7 +525,7 @@ cdef class Translational(_PairCompute):
         parameter."""
         return freud.util.make_managed_numpy_array(
             &self.thisptr.getOrder(),
-            freud.util.arr_type_t.COMPLEX_FLOAT)
+            freud.util.arr_type_t.COMPLEX_FLOAT)[:, 0]
 
     @property
     def k(self):
@@ -545,9 +596,16 @@ cdef class Steinhardt(_PairCompute):
         distinction, you can mask the output order parameter values using
         NumPy: :code:`numpy.nan_to_num(particle_order)`.
 
+    Several values of :math:`l` can be computed at once by passing a sequence
+    for :code:`l`. The spherical harmonics of all :math:`l` are then evaluated
+    in a single pass over the neighbor bonds, which is considerably faster
+    than computing each :math:`l` separately. In this case the per-particle
+    arrays have one column per :math:`l` and :code:`order` is an array, both
+    ordered like :code:`l`.
+
     Args:
-        l (unsigned int):
-            Spherical harmonic quantum number l.
+        l (unsigned int or sequence of unsigned int):
+            Spherical harmonic quantum number l, or a sequence of them.
         average (bool, optional):
             Determines whether to calculate the averaged Steinhardt order
             parameter (Default value = :code:`False`).
@@ -565,10 +623,13 @@ cdef class Steinhardt(_PairCompute):
             of the Steinhardt order parameter (Default value = :code:`False`).
     """  # noqa: E501
     cdef freud._order.Steinhardt * thisptr
+    cdef bint _multiple_l
 
     def __cinit__(self, l, average=False, wl=False, weighted=False,
                   wl_normalize=False):
-        self.thisptr = new freud._order.Steinhardt(l, average, wl, weighted,
+        self._multiple_l = np.ndim(l) != 0
+        cdef vector[unsigned int] ls = np.atleast_1d(l).tolist()
+        self.thisptr = new freud._order.Steinhardt(ls, average, wl, weighted,
                                                    wl_normalize)
 
     def __dealloc__(self):
@@ -597,33 +658,41 @@ cdef class Steinhardt(_PairCompute):
 
     @property
     def l(self):  # noqa: E743
-        """unsigned int: Spherical harmonic quantum number l."""
-        return self.thisptr.getL()
+        """unsigned int or list[unsigned int]: Spherical harmonic quantum
+        number l, or a list of them if several were given."""
+        ls = list(self.thisptr.getL())
+        return ls if self._multiple_l else ls[0]
 
     @_Compute._computed_property
     def order(self):
-        """float: The system wide normalization of the :math:`q_l` or
-        :math:`w_l` order parameter."""
-        return self.thisptr.getOrder()
+        """float or :class:`numpy.ndarray`: The system wide normalization of
+        the :math:`q_l` or :math:`w_l` order parameter, one value per
+        :math:`l` if several were given."""
+        order = list(self.thisptr.getOrder())
+        return np.asarray(order) if self._multiple_l else order[0]
 
     @_Compute._computed_property
     def particle_order(self):
-        """:math:`\\left(N_{particles}\\right)` :class:`numpy.ndarray`: Variant
-        of the Steinhardt order parameter for each particle (filled with
-        :code:`nan` for particles with no neighbors)."""
-        return freud.util.make_managed_numpy_array(
+        """:math:`\\left(N_{particles}\\right)` or :math:`\\left(N_{particles},
+        N_l\\right)` :class:`numpy.ndarray`: Variant of the Steinhardt order
+        parameter for each particle (filled with :code:`nan` for particles with
+        no neighbors)."""
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getParticleOrder(),
             freud.util.arr_type_t.FLOAT)
+        return array if self._multiple_l else array[:, 0]
 
     @_Compute._computed_property
     def ql(self):
-        """:math:`\\left(N_{particles}\\right)` :class:`numpy.ndarray`:
-        :math:`q_l` Steinhardt order parameter for each particle (filled with
-        :code:`nan` for particles with no neighbors). This is always available,
-        no matter which options are selected."""
-        return freud.util.make_managed_numpy_array(
+        """:math:`\\left(N_{particles}\\right)` or :math:`\\left(N_{particles},
+        N_l\\right)` :class:`numpy.ndarray`: :math:`q_l` Steinhardt order
+        parameter for each particle (filled with :code:`nan` for particles with
+        no neighbors). This is always available, no matter which options are
+        selected."""
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getQl(),
             freud.util.arr_type_t.FLOAT)
+        return array if self._multiple_l else array[:, 0]
 
     def compute(self, system, neighbors=None):
         R"""Compute the order parameter.
@@ -656,9 +725,10 @@ cdef class Steinhardt(_PairCompute):
         nq, nlist, qargs, l_query_points, num_query_points = \
             self._preprocess_arguments(system, neighbors=neighbors)
 
-        self.thisptr.compute(nlist.get_ptr(),
-                             nq.get_ptr(),
-                             dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.compute(nlist.get_ptr(),
+                                 nq.get_ptr(),
+                                 dereference(qargs.thisptr))
         return self
 
     def __repr__(self):
@@ -683,18 +753,28 @@ cdef class Steinhardt(_PairCompute):
             (:class:`matplotlib.axes.Axes`): Axis with the plot.
         """
         import freud.plot
-        xlabel = r"${mode_letter}{prime}_{{{sph_l}{average}}}$".format(
-            mode_letter='w' if self.wl else 'q',
-            prime='\'' if self.weighted else '',
-            sph_l=self.l,
-            average=',ave' if self.average else '')
-
+        labels = [
+            r"${mode_letter}{prime}_{{{sph_l}{average}}}$".format(
+                mode_letter='w' if self.wl else 'q',
+                prime='\'' if self.weighted else '',
+                sph_l=sph_l,
+                average=',ave' if self.average else '')
+            for sph_l in np.atleast_1d(self.l)]
+
+        if not self._multiple_l:
+            return freud.plot.histogram_plot(
+                self.particle_order,
+                title="Steinhardt Order Parameter " + labels[0],
+                xlabel=labels[0],
+                ylabel=r"Number of particles",
+                ax=ax)
         return freud.plot.histogram_plot(
             self.particle_order,
-            title="Steinhardt Order Parameter " + xlabel,
-            xlabel=xlabel,
+            title="Steinhardt Order Parameter",
+            xlabel="Order parameter",
             ylabel=r"Number of particles",
-            ax=ax)
+            ax=ax,
+            legend_labels=labels)
 
     def _repr_png_(self):
         try:
@@ -774,9 +854,10 @@ cdef class SolidLiquid(_PairCompute):
 
         nq, nlist, qargs, l_query_points, num_query_points = \
             self._preprocess_arguments(system, neighbors=neighbors)
-        self.thisptr.compute(nlist.get_ptr(),
-                             nq.get_ptr(),
-                             dereference(qargs.thisptr))
+        with nogil:
+            self.thisptr.compute(nlist.get_ptr(),
+                                 nq.get_ptr(),
+                                 dereference(qargs.thisptr))
 
     @property
     def l(self):  # noqa: E743
@@ -902,18 +983,49 @@ cdef class RotationalAutocorrelation(_Compute):
     analysis of a trajectory, the compute call needs to be
     done at each trajectory frame.
 
+    Summed over all hyperspherical harmonics of order :math:`l`, the
+    autocorrelation of a particle only depends on the angle :math:`\\omega`
+    of its rotation relative to the reference orientation, and is equal to
+    :math:`\\sin((l + 1) \\omega / 2) / ((l + 1) \\sin(\\omega / 2))`.
+    Several values of :math:`l` can therefore be computed at once, for the cost
+    of the largest one, by passing a sequence for :code:`l`. In this case the
+    per-particle arrays have one column per :math:`l` and :code:`order` is an
+    array, both ordered like :code:`l`.
+
+    Alternatively, the time correlation of a whole trajectory can be
+    accumulated by passing its frames in order to :meth:`accumulate`. Every
+    :code:`origin_interval`-th frame is kept as a reference origin, and each
+    frame is correlated with all origins that are at most :code:`max_lag`
+    frames older. The result, :code:`correlation`, is averaged over all
+    particles and origins for every lag from :code:`0` to :code:`max_lag`.
+    Only the origins within :code:`max_lag` frames are stored, so the memory
+    use does not grow with the length of the trajectory.
+
     Args:
-        l (int):
-            Order of the hyperspherical harmonic. Must be a positive, even
-            integer.
+        l (int or sequence of int):
+            Order of the hyperspherical harmonic, or a sequence of them. Must
+            be positive, even integers.
+        max_lag (unsigned int, optional):
+            Largest lag in frames of the time correlation accumulated by
+            :meth:`accumulate` (Default value = :code:`100`).
+        origin_interval (unsigned int, optional):
+            Number of frames between the reference origins used by
+            :meth:`accumulate` (Default value = :code:`1`).
     """
     cdef freud._order.RotationalAutocorrelation * thisptr
-
-    def __cinit__(self, l):
-        if l % 2 or l < 0:
-            raise ValueError(
-                "The quantum number must be a positive, even integer.")
-        self.thisptr = new freud._order.RotationalAutocorrelation(l)
+    cdef bint _multiple_l
+
+    def __cinit__(self, l, unsigned int max_lag=100,
+                  unsigned int origin_interval=1):
+        self._multiple_l = np.ndim(l) != 0
+        ls = np.atleast_1d(l).tolist()
+        for sph_l in ls:
+            if sph_l % 2 or sph_l < 0:
+                raise ValueError(
+                    "The quantum number must be a positive, even integer.")
+        cdef vector[unsigned int] l_ls = ls
+        self.thisptr = new freud._order.RotationalAutocorrelation(
+            l_ls, max_lag, origin_interval)
 
     def __dealloc__(self):
         del self.thisptr
@@ -936,31 +1048,110 @@ cdef class RotationalAutocorrelation(_Compute):
         cdef const float[:, ::1] l_orientations = orientations
         cdef unsigned int nP = orientations.shape[0]
 
-        self.thisptr.compute(
-            <quat[float]*> &l_ref_orientations[0, 0],
-            <quat[float]*> &l_orientations[0, 0],
-            nP)
+        with nogil:
+            self.thisptr.compute(
+                <quat[float]*> &l_ref_orientations[0, 0],
+                <quat[float]*> &l_orientations[0, 0],
+                nP)
         return self
 
+    def accumulate(self, orientations):
+        """Add the next frame of a trajectory to the time correlation.
+
+        Args:
+            orientations ((:math:`N_{orientations}`, 4) :class:`numpy.ndarray`):
+                Orientations in the frame. The number of orientations must be
+                the same in every frame.
+        """  # noqa
+        orientations = freud.util._convert_array(
+            orientations, shape=(None, 4))
+
+        cdef const float[:, ::1] l_orientations = orientations
+        cdef unsigned int nP = orientations.shape[0]
+
+        with nogil:
+            self.thisptr.accumulate(
+                <quat[float]*> &l_orientations[0, 0], nP)
+        return self
+
+    def reset(self):
+        R"""Forget all accumulated frames, so that the next call to
+        :meth:`accumulate` starts a new trajectory."""
+        self.thisptr.reset()
+
     @_Compute._computed_property
     def order(self):
-        """float: Autocorrelation of the system."""
-        return self.thisptr.getRotationalAutocorrelation()
+        """float or :class:`numpy.ndarray`: Autocorrelation of the system,
+        one value per :math:`l` if several were given."""
+        order = list(self.thisptr.getRotationalAutocorrelation())
+        return np.asarray(order) if self._multiple_l else order[0]
 
     @_Compute._computed_property
     def particle_order(self):
-        """(:math:`N_{orientations}`) :class:`numpy.ndarray`: Rotational
-        autocorrelation values calculated for each orientation."""
-        return freud.util.make_managed_numpy_array(
+        """(:math:`N_{orientations}`) or (:math:`N_{orientations}`, :math:`N_l`) :class:`numpy.ndarray`:
+        Rotational autocorrelation values calculated for each orientation."""  # noqa: E501
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getRAArray(),
             freud.util.arr_type_t.COMPLEX_FLOAT)
+        return array if self._multiple_l else array[:, 0]
+
+    @property
+    def num_frames(self):
+        """unsigned int: Number of frames accumulated since construction or
+        the last call to :meth:`reset`."""
+        return self.thisptr.getNumFrames()
+
+    @property
+    def correlation(self):
+        """(:code:`max_lag + 1`) or (:code:`max_lag + 1`, :math:`N_l`) :class:`numpy.ndarray`:
+        Accumulated time correlation for each lag in frames, averaged over
+        all particles and origins. Lags that no frame has reached yet are
+        zero."""  # noqa: E501
+        if self.num_frames == 0:
+            raise AttributeError(
+                "The accumulate method must be called before accessing "
+                "correlation.")
+        array = freud.util.make_managed_numpy_array(
+            &self.thisptr.getCorrelation(),
+            freud.util.arr_type_t.FLOAT)
+        return array if self._multiple_l else array[:, 0]
+
+    @property
+    def num_origins(self):
+        """(:code:`max_lag + 1`) :class:`numpy.ndarray`: Number of origins
+        averaged over for each lag of :code:`correlation`."""
+        if self.num_frames == 0:
+            raise AttributeError(
+                "The accumulate method must be called before accessing "
+                "num_origins.")
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getNumOrigins(),
+            freud.util.arr_type_t.UNSIGNED_INT)
 
     @property
     def l(self):  # noqa: E743
-        """int: The azimuthal quantum number, which defines the order of the
-        hyperspherical harmonic."""
-        return self.thisptr.getL()
+        """int or list[int]: The azimuthal quantum number, which defines the
+        order of the hyperspherical harmonic, or a list of them if several
+        were given."""
+        ls = list(self.thisptr.getL())
+        return ls if self._multiple_l else ls[0]
+
+    @property
+    def max_lag(self):
+        """unsigned int: Largest lag in frames of the accumulated time
+        correlation."""
+        return self.thisptr.getMaxLag()
+
+    @property
+    def origin_interval(self):
+        """unsigned int: Number of frames between the reference origins of the
+        accumulated time correlation."""
+        return self.thisptr.getOriginInterval()
 
     def __repr__(self):
-        return "freud.order.{cls}(l={sph_l})".format(cls=type(self).__name__,
-                                                     sph_l=self.l)
+        return ("freud.order.{cls}(l={sph_l}, max_lag={max_lag}, "
+                "origin_interval={origin_interval})").format(
+                    cls=type(self).__name__,
+                    sph_l=self.l,
+                    max_lag=self.max_lag,
+                    origin_interval=self.origin_interval)
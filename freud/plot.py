@@ -283,17 +283,22 @@ def line_plot(x, y, title=None, xlabel=None, ylabel=None, ax=None):
     return ax
 
 
-def histogram_plot(values, title=None, xlabel=None, ylabel=None, ax=None):
+def histogram_plot(
+    values, title=None, xlabel=None, ylabel=None, ax=None, legend_labels=None
+):
     """Helper function to draw a histogram graph.
 
     Args:
-        values (list): values of the histogram.
+        values (list): values of the histogram, or a 2D array whose columns
+            are drawn as separate histograms.
         title (str): Title of the graph. (Default value = :code:`None`).
         xlabel (str): Label of x axis. (Default value = :code:`None`).
         ylabel (str): Label of y axis. (Default value = :code:`None`).
         ax (:class:`matplotlib.axes.Axes`): Axes object to plot.
             If :code:`None`, make a new axes and figure object.
             (Default value = :code:`None`).
+        legend_labels (list): Labels of the columns of values, shown in a
+            legend if provided. (Default value = :code:`None`).
 
     Returns:
         :class:`matplotlib.axes.Axes`: Axes object with the diagram.
@@ -302,7 +307,9 @@ def histogram_plot(values, title=None, xlabel=None, ylabel=None, ax=None):
         fig = plt.figure()
         ax = fig.subplots()
 
-    ax.hist(values)
+    ax.hist(values, label=legend_labels)
+    if legend_labels is not None:
+        ax.legend()
     ax.set_title(title)
     ax.set_xlabel(xlabel)
     ax.set_ylabel(ylabel)
@@ -215,12 +215,13 @@ cdef class PMFTR12(_PMFT):
         cdef const float[::1] l_orientations = orientations
         cdef const float[::1] l_query_orientations = query_orientations
 
-        self.pmftr12ptr.accumulate(nq.get_ptr(),
-                                   <float*> &l_orientations[0],
-                                   <vec3[float]*> &l_query_points[0, 0],
-                                   <float*> &l_query_orientations[0],
-                                   num_query_points, nlist.get_ptr(),
-                                   dereference(qargs.thisptr))
+        with nogil:
+            self.pmftr12ptr.accumulate(nq.get_ptr(),
+                                       <float*> &l_orientations[0],
+                                       <vec3[float]*> &l_query_points[0, 0],
+                                       <float*> &l_query_orientations[0],
+                                       num_query_points, nlist.get_ptr(),
+                                       dereference(qargs.thisptr))
         return self
 
     def __repr__(self):
@@ -324,12 +325,13 @@ cdef class PMFTXYT(_PMFT):
         cdef const float[::1] l_orientations = orientations
         cdef const float[::1] l_query_orientations = query_orientations
 
-        self.pmftxytptr.accumulate(nq.get_ptr(),
-                                   <float*> &l_orientations[0],
-                                   <vec3[float]*> &l_query_points[0, 0],
-                                   <float*> &l_query_orientations[0],
-                                   num_query_points, nlist.get_ptr(),
-                                   dereference(qargs.thisptr))
+        with nogil:
+            self.pmftxytptr.accumulate(nq.get_ptr(),
+                                       <float*> &l_orientations[0],
+                                       <vec3[float]*> &l_query_points[0, 0],
+                                       <float*> &l_query_orientations[0],
+                                       num_query_points, nlist.get_ptr(),
+                                       dereference(qargs.thisptr))
         return self
 
     def __repr__(self):
@@ -433,11 +435,12 @@ cdef class PMFTXY(_PMFT):
             query_orientations, shape=(num_query_points, ))
         cdef const float[::1] l_query_orientations = query_orientations
 
-        self.pmftxyptr.accumulate(nq.get_ptr(),
-                                  <float*> &l_query_orientations[0],
-                                  <vec3[float]*> &l_query_points[0, 0],
-                                  num_query_points, nlist.get_ptr(),
-                                  dereference(qargs.thisptr))
+        with nogil:
+            self.pmftxyptr.accumulate(nq.get_ptr(),
+                                      <float*> &l_query_orientations[0],
+                                      <vec3[float]*> &l_query_points[0, 0],
+                                      num_query_points, nlist.get_ptr(),
+                                      dereference(qargs.thisptr))
         return self
 
     @_Compute._computed_property
@@ -597,14 +600,15 @@ cdef class PMFTXYZ(_PMFT):
         cdef const float[:, ::1] l_equiv_orientations = equiv_orientations
         cdef unsigned int num_equiv_orientations = \
             l_equiv_orientations.shape[0]
-        self.pmftxyzptr.accumulate(
-            nq.get_ptr(),
-            <quat[float]*> &l_query_orientations[0, 0],
-            <vec3[float]*> &l_query_points[0, 0],
-            num_query_points,
-            <quat[float]*> &l_equiv_orientations[0, 0],
-            num_equiv_orientations, nlist.get_ptr(),
-            dereference(qargs.thisptr))
+        with nogil:
+            self.pmftxyzptr.accumulate(
+                nq.get_ptr(),
+                <quat[float]*> &l_query_orientations[0, 0],
+                <vec3[float]*> &l_query_points[0, 0],
+                num_query_points,
+                <quat[float]*> &l_equiv_orientations[0, 0],
+                num_equiv_orientations, nlist.get_ptr(),
+                dereference(qargs.thisptr))
         return self
 
     def __repr__(self):
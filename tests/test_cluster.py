@@ -52,6 +52,12 @@ class TestCluster:
             clust.compute(nq, neighbors=neighbors)
             assert np.all(clust.cluster_idx == idx)
 
+        # Half neighbor lists find the same clusters
+        aq = freud.locality.AABBQuery(box, positions)
+        half = aq.query(positions, dict(r_max=0.5, half_list=True)).toNeighborList()
+        clust.compute(aq, neighbors=half)
+        assert np.all(clust.cluster_idx == idx)
+
         # Test if attributes are accessible now
         clust.num_clusters
         clust.cluster_idx
@@ -118,6 +124,99 @@ class TestCluster:
 
         npt.assert_allclose(clp.centers, [[-1.4, 0, 0]], rtol=1e-5, atol=1e-5)
 
+    def test_cluster_props_masses_shapes(self):
+        "Tests masses, radii of gyration, and shape anisotropies."
+        box = freud.Box.cube(10)
+
+        # A rod across the periodic boundary and an octahedron
+        points = [
+            [4.5, 1, 1],
+            [-4.5, 1, 1],
+            [3.5, 1, 1],
+            [-3.5, 1, 1],
+            [1, -2, -2],
+            [-1, -2, -2],
+            [0, -1, -2],
+            [0, -3, -2],
+            [0, -2, -1],
+            [0, -2, -3],
+        ]
+        cluster_idx = [0, 0, 0, 0, 1, 1, 1, 1, 1, 1]
+
+        clp = freud.cluster.ClusterProperties()
+        clp.compute((box, points), cluster_idx)
+        npt.assert_equal(clp.sizes, [4, 6])
+        npt.assert_allclose(clp.masses, [4, 6])
+        expected_centers = [[5, 1, 1], [0, -2, -2]]
+        npt.assert_allclose(box.wrap(clp.centers - expected_centers), 0, atol=1e-5)
+        npt.assert_allclose(clp.radii_of_gyration, [np.sqrt(1.25), 1], rtol=1e-5)
+        npt.assert_allclose(
+            clp.radii_of_gyration,
+            np.sqrt(np.trace(clp.gyrations, axis1=-2, axis2=-1)),
+            rtol=1e-5,
+        )
+        npt.assert_allclose(clp.shape_anisotropies, [1, 0], atol=1e-5)
+
+        # Weighting the rod by mass shifts its center
+        masses = np.array([3, 1, 3, 1, 1, 1, 1, 1, 1, 1])
+        clp.compute((box, points), cluster_idx, masses)
+        npt.assert_allclose(clp.masses, [8, 6])
+        rod_center = box.center_of_mass(points[:4], masses[:4])
+        npt.assert_allclose(box.wrap(clp.centers[0] - rod_center), 0, atol=1e-5)
+        rod_deltas = box.wrap(np.array(points[:4]) - rod_center)
+        rod_gyration = np.einsum("i,ij,ik->jk", masses[:4], rod_deltas, rod_deltas)
+        rod_gyration /= np.sum(masses[:4])
+        npt.assert_allclose(clp.gyrations[0], rod_gyration, atol=1e-5)
+        npt.assert_allclose(clp.gyrations[1], np.eye(3) / 3, atol=1e-5)
+        npt.assert_allclose(clp.shape_anisotropies, [1, 0], atol=1e-5)
+
+    def test_cluster_props_wide(self):
+        "Tests gyration tensors of clusters wider than half of the box."
+        box = freud.Box.cube(10)
+        points = np.zeros((7, 3))
+        points[:, 0] = np.arange(-3, 4)
+
+        clp = freud.cluster.ClusterProperties()
+        clp.compute((box, points), np.zeros(len(points)))
+        npt.assert_allclose(clp.centers, [[0, 0, 0]], atol=1e-5)
+        expected_gyration = np.zeros((3, 3))
+        expected_gyration[0, 0] = 4
+        npt.assert_allclose(clp.gyrations[0], expected_gyration, atol=1e-5)
+
+    def test_cluster_props_large(self):
+        "Tests a cluster with enough points to be split across tasks."
+        box = freud.Box.cube(10)
+        points = np.random.default_rng(4).normal(scale=1.5, size=(20000, 3))
+        points = box.wrap(points + [4, -4, 0])
+        cluster_idx = np.zeros(len(points), dtype=np.uint32)
+        cluster_idx[::2] = 1
+
+        clp = freud.cluster.ClusterProperties()
+        clp.compute((box, points), cluster_idx)
+        npt.assert_equal(clp.sizes, [10000, 10000])
+        for c in range(2):
+            cluster_points = points[cluster_idx == c]
+            center = box.center_of_mass(cluster_points)
+            npt.assert_allclose(box.wrap(clp.centers[c] - center), 0, atol=1e-3)
+            deltas = box.wrap(cluster_points - center)
+            gyration = deltas.T @ deltas / len(deltas)
+            npt.assert_allclose(clp.gyrations[c], gyration, rtol=1e-3, atol=1e-3)
+
+    def test_cluster_props_singletons(self):
+        "Tests many clusters of one point each, in shuffled order."
+        num_points = 10000
+        box, points = freud.data.make_random_system(10, num_points, seed=3)
+        cluster_idx = np.random.default_rng(3).permutation(num_points)
+        masses = np.arange(num_points) + 1
+
+        clp = freud.cluster.ClusterProperties()
+        clp.compute((box, points), cluster_idx, masses)
+        npt.assert_equal(clp.sizes, 1)
+        npt.assert_allclose(clp.masses[cluster_idx], masses)
+        npt.assert_allclose(box.wrap(clp.centers[cluster_idx] - points), 0, atol=1e-4)
+        npt.assert_allclose(clp.gyrations, 0, atol=1e-5)
+        npt.assert_allclose(clp.radii_of_gyration, 0, atol=1e-5)
+
     def test_cluster_keys(self):
         Nlattice = 4
         Nrep = 5
@@ -154,6 +253,43 @@ class TestCluster:
 
         assert np.all(ckeys == check_values)
 
+    @pytest.mark.parametrize("r_max", [0.5, 0.8, 1.2])
+    def test_random_system(self, r_max):
+        """Compare against connected components of the neighbor graph, with
+        clusters sorted by size and then by smallest point index."""
+        N = 2000
+        box, points = freud.data.make_random_system(12, N, seed=0)
+        nlist = (
+            freud.locality.AABBQuery(box, points)
+            .query(points, dict(r_max=r_max, exclude_ii=True))
+            .toNeighborList()
+        )
+
+        parents = np.arange(N)
+
+        def find(i):
+            while parents[i] != i:
+                parents[i] = parents[parents[i]]
+                i = parents[i]
+            return i
+
+        for i, j in nlist[:]:
+            ri, rj = find(i), find(j)
+            parents[max(ri, rj)] = min(ri, rj)
+        roots = np.array([find(i) for i in range(N)])
+        unique_roots, counts = np.unique(roots, return_counts=True)
+        # The roots are the smallest point index in each cluster.
+        order = np.lexsort((unique_roots, -counts))
+        labels = np.empty(N, dtype=np.uint32)
+        labels[unique_roots[order]] = np.arange(len(order))
+
+        clust = freud.cluster.Cluster()
+        clust.compute((box, points), neighbors=dict(r_max=r_max))
+        assert clust.num_clusters == len(unique_roots)
+        npt.assert_array_equal(clust.cluster_idx, labels[roots])
+        for c, keys in enumerate(clust.cluster_keys):
+            npt.assert_array_equal(keys, np.flatnonzero(clust.cluster_idx == c))
+
     def test_repr(self):
         clust = freud.cluster.Cluster()
         assert str(clust) == str(eval(repr(clust)))
@@ -174,6 +310,97 @@ class TestCluster:
         plt.close("all")
 
 
+class TestClusterTracker:
+    @staticmethod
+    def _frame(*chains):
+        """Build a frame of 30 points. Each chain is a pair of point indices
+        and an origin, and places those points on a line with spacing 0.5.
+        All other points are isolated."""
+        points = np.zeros((30, 3), dtype=np.float32)
+        points[:, 0] = -40 + 2.5 * np.arange(30)
+        points[:, 1] = 30
+        for indices, origin in chains:
+            points[indices] = np.asarray(origin) + np.outer(
+                0.5 * np.arange(len(indices)), [1, 0, 0]
+            )
+        return freud.box.Box.cube(100), points
+
+    def test_events(self):
+        a = np.arange(10)
+        b = np.arange(10, 20)
+        c = np.arange(20, 25)
+        frames = [
+            self._frame((a, [0, 0, 0]), (b, [20, 0, 0])),
+            self._frame((a, [0, 0, 0]), (b, [5, 0, 0])),
+            self._frame((a, [0, 0, 0]), (b, [20, 0, 0]), (c, [0, 10, 0])),
+            self._frame(),
+        ]
+        tracker = freud.cluster.ClusterTracker(min_size=2)
+        neighbors = dict(r_max=0.6)
+
+        with pytest.raises(AttributeError):
+            tracker.events
+
+        tracker.compute(frames[0], neighbors=neighbors)
+        npt.assert_array_equal(tracker.cluster_ids, [0, 1])
+        assert tracker.events == []
+
+        # Chains a and b merge and the result keeps the id of a.
+        tracker.compute(frames[1], neighbors=neighbors)
+        npt.assert_array_equal(tracker.cluster_ids, [0])
+        assert tracker.events == [("merge", 0, 0), ("merge", 1, 0)]
+
+        # The merged chain splits and a new chain c forms.
+        tracker.compute(frames[2], neighbors=neighbors)
+        npt.assert_array_equal(tracker.cluster_ids, [0, 2, 3])
+        npt.assert_array_equal(tracker.cluster_idx[c], 2)
+        assert tracker.events == [
+            ("birth", None, 3),
+            ("split", 0, 0),
+            ("split", 0, 2),
+        ]
+
+        tracker.compute(frames[3], neighbors=neighbors)
+        assert len(tracker.cluster_ids) == 0
+        assert tracker.num_clusters == 30
+        assert tracker.events == [
+            ("death", 0, None),
+            ("death", 2, None),
+            ("death", 3, None),
+        ]
+        assert tracker.num_frames == 4
+
+        tracker.reset()
+        tracker.compute(frames[2], neighbors=neighbors)
+        npt.assert_array_equal(tracker.cluster_ids, [0, 1, 2])
+        assert tracker.num_frames == 1
+
+    def test_persistent_ids(self):
+        """Unchanged clusters keep their ids."""
+        box, points = freud.data.make_random_system(10, 500, seed=0)
+        tracker = freud.cluster.ClusterTracker(min_size=3)
+        neighbors = dict(r_max=0.8)
+        tracker.compute((box, points), neighbors=neighbors)
+        cluster = freud.cluster.Cluster().compute((box, points), neighbors=neighbors)
+        npt.assert_array_equal(tracker.cluster_idx, cluster.cluster_idx)
+        ids = tracker.cluster_ids.copy()
+        assert len(ids) > 0
+        for _ in range(3):
+            tracker.compute((box, points), neighbors=neighbors)
+            npt.assert_array_equal(tracker.cluster_ids, ids)
+            assert tracker.events == []
+        with pytest.raises(ValueError):
+            tracker.compute((box, points[:-1]), neighbors=neighbors)
+
+    def test_invalid_min_size(self):
+        with pytest.raises(ValueError):
+            freud.cluster.ClusterTracker(min_size=0)
+
+    def test_repr(self):
+        tracker = freud.cluster.ClusterTracker(min_size=4)
+        assert str(tracker) == str(eval(repr(tracker)))
+
+
 class TestClusterManagedArray(ManagedArrayTestBase):
     def build_object(self):
         self.obj = freud.cluster.Cluster()
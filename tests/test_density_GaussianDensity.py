@@ -133,6 +133,100 @@ class TestGaussianDensity:
             # This has discretization error as well as single-precision error
             assert np.isclose(np.sum(gd.density), np.sum(values), rtol=1e-4)
 
+    def test_explicit_2d(self):
+        # The grid is large enough to be split into several tiles
+        width = (200, 150)
+        r_max = 3
+        sigma = 0.5
+        num_points = 50
+        box, points = freud.data.make_random_system(40, num_points, is2D=True, seed=3)
+        values = np.random.default_rng(3).random(num_points)
+        gd = freud.density.GaussianDensity(width, r_max, sigma)
+        gd.compute((box, points), values)
+
+        # Evaluate the Gaussian of every point at every grid cell center
+        x = (np.arange(width[0]) + 0.5) * box.Lx / width[0] - box.Lx / 2
+        y = (np.arange(width[1]) + 0.5) * box.Ly / width[1] - box.Ly / 2
+        centers = np.stack(np.meshgrid(x, y, [0], indexing="ij"), axis=-1)
+        centers = centers.reshape(-1, 3)
+        expected = np.zeros(len(centers))
+        for point, value in zip(points, values):
+            r_sq = np.sum(box.wrap(centers - point) ** 2, axis=-1)
+            gaussian = value * np.exp(-r_sq / (2 * sigma ** 2))
+            expected += np.where(r_sq < r_max ** 2, gaussian, 0)
+        expected /= 2 * np.pi * sigma ** 2
+
+        npt.assert_allclose(gd.density, expected.reshape(width), atol=1e-5)
+
+    @pytest.mark.parametrize("is2D", [True, False])
+    def test_modes(self, is2D):
+        # sigma is six grid cells wide
+        width = (100, 100) if is2D else (60, 60, 60)
+        r_max = 5 if is2D else 7
+        sigma = 1.2 if is2D else 2
+        num_points = 20
+        box, points = freud.data.make_random_system(20, num_points, is2D=is2D, seed=1)
+        values = np.random.default_rng(1).random(num_points)
+        densities = {}
+        for mode in ("direct", "separable", "fft", "auto"):
+            gd = freud.density.GaussianDensity(width, r_max, sigma, mode=mode)
+            assert gd.mode == mode
+            densities[mode] = gd.compute((box, points), values).density
+
+        # The separable method only differs from the direct method by rounding
+        npt.assert_allclose(densities["separable"], densities["direct"], atol=1e-5)
+        npt.assert_allclose(densities["auto"], densities["direct"], atol=1e-5)
+
+        # The FFT method applies the cutoff to the offsets between grid cells,
+        # which differs from the direct method by the Gaussian at r_max
+        peak = np.max(values) / (2 * np.pi * sigma ** 2) ** (box.dimensions / 2)
+        npt.assert_allclose(densities["fft"], densities["direct"], atol=0.01 * peak)
+        npt.assert_allclose(
+            np.sum(densities["fft"]), np.sum(densities["direct"]), rtol=1e-3
+        )
+
+    @pytest.mark.parametrize("is2D", [True, False])
+    def test_fft_mode_accuracy(self, is2D):
+        # With a wide Gaussian and a distant cutoff the FFT method matches the
+        # direct method closely. Many points make it the cheapest method, so
+        # the automatic mode uses it too.
+        if is2D:
+            L, width, r_max, sigma, num_points = (64, 128, 15, 3, 2000)
+        else:
+            L, width, r_max, sigma, num_points = (24, 48, 10, 2, 100)
+        box, points = freud.data.make_random_system(L, num_points, is2D=is2D, seed=2)
+        direct = freud.density.GaussianDensity(width, r_max, sigma, mode="direct")
+        expected = direct.compute((box, points)).density
+        peak = 1 / (2 * np.pi * sigma ** 2) ** (box.dimensions / 2)
+        for mode in ("fft", "auto"):
+            gd = freud.density.GaussianDensity(width, r_max, sigma, mode=mode)
+            npt.assert_allclose(
+                gd.compute((box, points)).density, expected, atol=2e-4 * peak
+            )
+
+    def test_mode_errors(self):
+        with pytest.raises(ValueError):
+            freud.density.GaussianDensity(50, 3, 1, mode="invalid")
+
+        points = np.zeros((1, 3))
+        triclinic_box = freud.box.Box(10, 10, 10, 0.5)
+        for mode in ("separable", "fft"):
+            gd = freud.density.GaussianDensity(50, 3, 1, mode=mode)
+            with pytest.raises(ValueError):
+                gd.compute((triclinic_box, points))
+
+        aperiodic_box = freud.box.Box.cube(10)
+        aperiodic_box.periodic = False
+        gd = freud.density.GaussianDensity(50, 3, 1, mode="fft")
+        with pytest.raises(ValueError):
+            gd.compute((aperiodic_box, points))
+
+        # The direct and automatic methods support any box
+        for mode in ("direct", "auto"):
+            gd = freud.density.GaussianDensity(50, 3, 1, mode=mode)
+            gd.compute((triclinic_box, points))
+            gd.compute((aperiodic_box, points))
+
     def test_repr(self):
         gd = freud.density.GaussianDensity(100, 10.0, 0.1)
         assert str(gd) == str(eval(repr(gd)))
@@ -141,6 +235,9 @@ class TestGaussianDensity:
         gd3 = freud.density.GaussianDensity((98, 99, 100), 10.0, 0.1)
         assert str(gd3) == str(eval(repr(gd3)))
 
+        gd_fft = freud.density.GaussianDensity(100, 10.0, 0.1, mode="fft")
+        assert str(gd_fft) == str(eval(repr(gd_fft)))
+
     def test_repr_png(self):
         width = 100
         r_max = 10.0
@@ -70,6 +70,17 @@ class TestLocalDensity:
         neighbors = self.ld.num_neighbors
         npt.assert_array_less(np.fabs(neighbors - 1130.973355292), 200)
 
+    def test_half_list(self):
+        """Test that LocalDensity rejects half neighbor lists, which would
+        miss half of the neighbors of each point."""
+        aq = freud.locality.AABBQuery(self.box, self.pos)
+        query_args = dict(r_max=self.r_max, half_list=True)
+        with pytest.raises(ValueError):
+            self.ld.compute(aq, neighbors=query_args)
+        nlist = aq.query(self.pos, query_args).toNeighborList()
+        with pytest.raises(ValueError):
+            self.ld.compute(aq, neighbors=nlist)
+
     def test_repr(self):
         assert str(self.ld) == str(eval(repr(self.ld)))
 
@@ -165,6 +165,25 @@ class TestRDF:
 
             npt.assert_allclose(rdf.n_r, supposed_RDF, atol=1e-6)
 
+    def test_half_list(self):
+        r_max = 3.0
+        bins = 30
+        box, points = freud.data.make_random_system(12, 2000, seed=0)
+        aq = freud.locality.AABBQuery(box, points)
+
+        rdf_full = freud.density.RDF(bins, r_max)
+        rdf_full.compute(aq, neighbors=dict(r_max=r_max, exclude_ii=True))
+
+        # Half lists count every pair once and are weighted to match.
+        rdf_half = freud.density.RDF(bins, r_max)
+        rdf_half.compute(aq, neighbors=dict(r_max=r_max, half_list=True))
+        npt.assert_allclose(rdf_half.rdf, rdf_full.rdf, rtol=1e-5)
+        npt.assert_allclose(rdf_half.n_r, rdf_full.n_r, rtol=1e-5)
+
+        nlist = aq.query(points, dict(r_max=r_max, half_list=True)).toNeighborList()
+        rdf_half.compute(aq, neighbors=nlist)
+        npt.assert_allclose(rdf_half.rdf, rdf_full.rdf, rtol=1e-5)
+
     def test_empty_histogram(self):
         r_max = 0.5
         bins = 10
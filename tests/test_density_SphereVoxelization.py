@@ -101,6 +101,36 @@ class TestSphereVoxelization:
             assert num_ones > 0
             assert num_zeros + num_ones == np.prod(vox.voxels.shape)
 
+    @pytest.mark.parametrize("is2D", [True, False])
+    def test_exact_voxels(self, is2D):
+        # Widths that are not multiples of 32 exercise the partially filled
+        # words at the end of each packed row.
+        width = (37, 45) if is2D else (37, 45, 70)
+        r_max = 1.7
+        box_size = 10.0
+        box, points = freud.data.make_random_system(box_size, 20, is2D=is2D, seed=7)
+        vox = freud.density.SphereVoxelization(width, r_max)
+        vox.compute((box, points))
+        assert vox.voxels.shape == width
+        assert vox.voxels.dtype == np.uint8
+        # The unpacked voxels are reused until the next computation
+        assert vox.voxels is vox.voxels
+
+        # Compare against the minimum image distance from every voxel center
+        # to every sphere, ignoring voxels within rounding error of a surface.
+        dims = len(width)
+        centers = np.meshgrid(
+            *[(np.arange(w) + 0.5) * box_size / w - box_size / 2 for w in width],
+            indexing="ij",
+        )
+        centers = np.stack(centers, axis=-1).reshape(-1, dims)
+        deltas = centers[:, np.newaxis, :] - points[np.newaxis, :, :dims]
+        deltas -= box_size * np.round(deltas / box_size)
+        distances = np.linalg.norm(deltas, axis=-1).min(axis=1).reshape(width)
+        voxels = vox.voxels
+        assert np.all(voxels[distances < r_max - 1e-4] == 1)
+        assert np.all(voxels[distances > r_max + 1e-4] == 0)
+
     def test_change_box_dimension(self):
         width = 100
         r_max = 10.0
@@ -375,6 +375,39 @@ class NeighborQueryTest:
 
         assert ij1 == ij2
 
+    def test_half_list(self):
+        L, r_max, N = (10, 2.01, 1024)
+
+        box, points = freud.data.make_random_system(L, N)
+        nq = self.build_query_object(box, points, r_max)
+        full = nq.query(points, dict(r_max=r_max, exclude_ii=True)).toNeighborList()
+        half = nq.query(points, dict(r_max=r_max, half_list=True)).toNeighborList()
+
+        assert not full.half_list
+        assert half.half_list
+        assert np.all(half.query_point_indices < half.point_indices)
+        assert {(i, j) for i, j in half} == {(i, j) for i, j in full if i < j}
+
+        # Iterating over the query directly also yields only i < j bonds.
+        result = nq.query(points, dict(r_max=r_max, half_list=True))
+        ij = {(x[0], x[1]) for x in result}
+        assert ij == {(i, j) for i, j in half}
+
+        # Copies keep the flag.
+        assert half.copy().half_list
+
+        # Equal points with a different dtype are the same points.
+        half64 = nq.query(points.astype(np.float64), dict(r_max=r_max, half_list=True))
+        assert {(i, j) for i, j in half64.toNeighborList()} == {(i, j) for i, j in half}
+
+        # Half lists are only defined when querying the points themselves.
+        with pytest.raises(RuntimeError):
+            nq.query(points[:10], dict(r_max=r_max, half_list=True)).toNeighborList()
+
+        # Nearest neighbor relations are not symmetric.
+        with pytest.raises(RuntimeError):
+            nq.query(points, dict(num_neighbors=4, half_list=True)).toNeighborList()
+
     def test_exhaustive_search(self):
         L, r_max, N = (10, 1.999, 32)
 
@@ -654,6 +687,46 @@ class TestNeighborQueryAABB(NeighborQueryTest):
                 else:
                     original_nlist = nlist
 
+    @pytest.mark.parametrize("is2D", [True, False])
+    def test_update_points(self, is2D):
+        """Ensure that refitting the tree gives the same results as a new tree."""
+        L = 10
+        N = 1000
+        box, points = freud.data.make_random_system(L, N, is2D=is2D, seed=0)
+        rng = np.random.default_rng(0)
+        aq = freud.locality.AABBQuery(box, points)
+
+        num_rebuilds = 0
+        for _ in range(10):
+            displacements = rng.uniform(-0.05, 0.05, points.shape)
+            if is2D:
+                displacements[:, 2] = 0
+            points = box.wrap(points + displacements)
+            num_rebuilds += aq.update_points(points)
+            npt.assert_allclose(aq.points, points)
+            for query_args in [dict(r_max=1.5), dict(num_neighbors=6)]:
+                nlist1 = aq.query(points, query_args).toNeighborList()
+                nlist2 = (
+                    freud.locality.AABBQuery(box, points)
+                    .query(points, query_args)
+                    .toNeighborList()
+                )
+                assert nlist_equal(nlist1, nlist2)
+
+        # Small displacements should refit the tree instead of rebuilding it.
+        assert num_rebuilds < 10
+
+        # Changing the number of points always rebuilds the tree.
+        _, new_points = freud.data.make_random_system(L, N // 2, is2D=is2D)
+        assert aq.update_points(new_points)
+        nlist1 = aq.query(new_points, dict(r_max=1.5)).toNeighborList()
+        nlist2 = (
+            freud.locality.AABBQuery(box, new_points)
+            .query(new_points, dict(r_max=1.5))
+            .toNeighborList()
+        )
+        assert nlist_equal(nlist1, nlist2)
+
 
 class TestNeighborQueryLinkCell(NeighborQueryTest):
     @classmethod
@@ -691,6 +764,21 @@ class TestNeighborQueryLinkCell(NeighborQueryTest):
         nlist2 = lc.query(points, dict(r_max=r_max, exclude_ii=True)).toNeighborList()
         assert nlist_equal(nlist1, nlist2)
 
+    def test_anisotropic_box(self):
+        """Check that a box much longer in one dimension than the others
+        builds quickly and finds the same neighbors as AABBQuery."""
+        N = 1000
+        r_max = 2.5
+        box = freud.box.Box(400, 6, 6)
+        np.random.seed(0)
+        points = box.make_absolute(np.random.rand(N, 3))
+        lc = freud.locality.LinkCell(box, points, 0.5)
+        aq = freud.locality.AABBQuery(box, points)
+        query_args = dict(r_max=r_max, exclude_ii=True)
+        nlist1 = lc.query(points, query_args).toNeighborList()
+        nlist2 = aq.query(points, query_args).toNeighborList()
+        assert nlist_equal(nlist1, nlist2)
+
 
 class TestMultipleMethods:
     """Check that different methods of making a NeighborList give the same
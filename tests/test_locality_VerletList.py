@@ -0,0 +1,114 @@
+import numpy as np
+import numpy.testing as npt
+import pytest
+
+import freud
+
+
+def _bond_set(nlist):
+    return set(zip(nlist.query_point_indices, nlist.point_indices))
+
+
+class TestVerletList:
+    def test_matches_ball_query(self):
+        L = 10
+        N = 500
+        r_max = 1.5
+        r_min = 0.2
+        box, points = freud.data.make_random_system(L, N, seed=0)
+        rng = np.random.default_rng(0)
+        vl = freud.locality.VerletList(r_max, skin=0.3, r_min=r_min, exclude_ii=True)
+        query_args = dict(r_max=r_max, r_min=r_min, exclude_ii=True)
+
+        for _ in range(20):
+            points = box.wrap(
+                points + rng.uniform(-0.02, 0.02, points.shape).astype(np.float32)
+            )
+            vl.compute((box, points))
+            ref = (
+                freud.locality.AABBQuery(box, points)
+                .query(points, query_args)
+                .toNeighborList()
+            )
+            assert _bond_set(vl.nlist) == _bond_set(ref)
+            # Bonds are sorted by query point index.
+            assert np.all(np.diff(vl.nlist.query_point_indices) >= 0)
+            wrapped_distances = np.linalg.norm(
+                box.wrap(
+                    points[vl.nlist.point_indices]
+                    - points[vl.nlist.query_point_indices]
+                ),
+                axis=-1,
+            )
+            npt.assert_allclose(wrapped_distances, vl.nlist.distances, atol=1e-5)
+
+        # Small displacements should not trigger a rebuild every frame.
+        assert 1 <= vl.num_builds < 20
+
+    def test_query_points(self):
+        L = 10
+        box, points = freud.data.make_random_system(L, 200, seed=1)
+        _, query_points = freud.data.make_random_system(L, 50, seed=2)
+        vl = freud.locality.VerletList(2.0, skin=0.5)
+        vl.compute((box, points), query_points)
+        ref = (
+            freud.locality.AABBQuery(box, points)
+            .query(query_points, dict(r_max=2.0))
+            .toNeighborList()
+        )
+        assert _bond_set(vl.nlist) == _bond_set(ref)
+
+    def test_rebuild_threshold(self):
+        L = 10
+        box = freud.box.Box.cube(L)
+        points = np.array([[0, 0, 0], [1, 0, 0], [3, 0, 0]], dtype=np.float32)
+        vl = freud.locality.VerletList(1.5, skin=0.4)
+
+        vl.compute((box, points))
+        assert vl.rebuilt
+        assert vl.num_builds == 1
+
+        # Moving by less than skin / 2 reuses the buffered list.
+        points[2, 0] -= 0.15
+        vl.compute((box, points))
+        assert not vl.rebuilt
+        assert vl.num_builds == 1
+
+        # Moving past skin / 2 forces a rebuild.
+        points[2, 0] -= 0.1
+        vl.compute((box, points))
+        assert vl.rebuilt
+        assert vl.num_builds == 2
+
+        # Changing the box forces a rebuild.
+        vl.compute((freud.box.Box.cube(L + 1), points))
+        assert vl.rebuilt
+        assert vl.num_builds == 3
+
+        vl.reset()
+        vl.compute((freud.box.Box.cube(L + 1), points))
+        assert vl.rebuilt
+
+    def test_invalid_arguments(self):
+        with pytest.raises(ValueError):
+            freud.locality.VerletList(0, skin=0.5)
+        with pytest.raises(ValueError):
+            freud.locality.VerletList(1, skin=-0.5)
+        with pytest.raises(ValueError):
+            freud.locality.VerletList(1, skin=0.5, r_min=1)
+
+    def test_attributes(self):
+        vl = freud.locality.VerletList(1.5, skin=0.3)
+        with pytest.raises(AttributeError):
+            vl.nlist
+        with pytest.raises(AttributeError):
+            vl.rebuilt
+        box, points = freud.data.make_random_system(10, 40)
+        vl.compute((box, points))
+        vl.nlist
+        vl.rebuilt
+        vl.num_builds
+
+    def test_repr(self):
+        vl = freud.locality.VerletList(1.5, skin=0.25, r_min=0.5, exclude_ii=True)
+        assert str(vl) == str(eval(repr(vl)))
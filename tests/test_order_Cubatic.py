@@ -1,9 +1,12 @@
+import warnings
+
 import numpy as np
 import numpy.testing as npt
 import pytest
 import rowan
 
 import freud
+from freud.errors import FreudDeprecationWarning
 
 
 class TestCubatic:
@@ -24,7 +27,8 @@ class TestCubatic:
         t_final = 0.001
         scale = 0.95
         n_replicates = 10
-        cop = freud.order.Cubatic(t_initial, t_final, scale, n_replicates)
+        with pytest.warns(FreudDeprecationWarning):
+            cop = freud.order.Cubatic(t_initial, t_final, scale, n_replicates)
 
         # Test access
         with pytest.raises(AttributeError):
@@ -92,7 +96,8 @@ class TestCubatic:
         orientations = rowan.from_axis_angle(axes, angles)
 
         # create cubatic object
-        cubatic = freud.order.Cubatic(5.0, 0.001, 0.95, 10)
+        with pytest.warns(FreudDeprecationWarning):
+            cubatic = freud.order.Cubatic(5.0, 0.001, 0.95, 10)
         cubatic.compute(orientations)
         # get the op
         op = cubatic.order
@@ -105,6 +110,42 @@ class TestCubatic:
             op_max, 0.2, err_msg="per particle order parameter value is too high"
         )
 
+    def test_deterministic(self):
+        # Rotate nearly aligned cubes by a random global rotation, along with
+        # random symmetry operations of the cube.
+        N = 1000
+        np.random.seed(0)
+        global_orientation = rowan.random.rand(1)
+        angles = np.random.uniform(low=0.0, high=0.1, size=N)
+        axes = np.random.normal(size=(N, 3))
+        cube_rotations = rowan.from_axis_angle(
+            [[1, 0, 0], [0, 1, 0], [0, 0, 1]], np.pi / 2
+        )[np.random.randint(3, size=N)]
+        orientations = rowan.multiply(
+            global_orientation,
+            rowan.multiply(rowan.from_axis_angle(axes, angles), cube_rotations),
+        )
+
+        with pytest.warns(FreudDeprecationWarning):
+            first = freud.order.Cubatic(5.0, 0.001, 0.95, 1, seed=1)
+        first.compute(orientations)
+        with pytest.warns(FreudDeprecationWarning):
+            second = freud.order.Cubatic(n_replicates=20, seed=2)
+        second.compute(orientations)
+
+        assert first.order > 0.99
+        assert first.order == second.order
+        npt.assert_array_equal(first.orientation, second.orientation)
+        npt.assert_array_equal(first.particle_order, second.particle_order)
+
+        # The cubatic orientation matches the global rotation up to the
+        # symmetries of the cube, so both give the same cubatic tensor.
+        reference = freud.order.Cubatic()
+        reference.compute(np.tile(global_orientation, (N, 1)))
+        npt.assert_allclose(
+            first.cubatic_tensor, reference.cubatic_tensor, atol=1e-2
+        )
+
     def test_valid_inputs(self):
         with pytest.raises(ValueError):
             # t_initial must be greater than t_final
@@ -126,6 +167,24 @@ class TestCubatic:
             # scale must be greater than 0
             freud.order.Cubatic(t_initial=5.0, t_final=0.001, scale=0, n_replicates=10)
 
+    def test_deprecated_arguments(self):
+        # The default arguments do not warn
+        with warnings.catch_warnings():
+            warnings.simplefilter("error")
+            freud.order.Cubatic()
+            freud.order.Cubatic(5.0, 0.001, 0.95, 1, None)
+
+        for kwargs in (
+            dict(t_initial=4.0),
+            dict(t_final=0.01),
+            dict(scale=0.9),
+            dict(n_replicates=10),
+            dict(seed=0),
+        ):
+            with pytest.warns(FreudDeprecationWarning):
+                freud.order.Cubatic(**kwargs)
+
     def test_repr(self):
-        cubatic = freud.order.Cubatic(5.0, 0.001, 0.95, 10)
-        assert str(cubatic) == str(eval(repr(cubatic)))
+        with pytest.warns(FreudDeprecationWarning):
+            cubatic = freud.order.Cubatic(5.0, 0.001, 0.95, 10)
+            assert str(cubatic) == str(eval(repr(cubatic)))
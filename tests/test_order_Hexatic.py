@@ -190,6 +190,26 @@ class TestHexatic:
                 psi_k_weighted, hop_weighted.particle_order[0], atol=1e-5
             )
 
+    def test_multiple_k(self):
+        box, points = freud.data.make_random_system(10, 500, is2D=True, seed=1)
+        voro = freud.locality.Voronoi()
+        voro.compute(system=(box, points))
+        ks = [12, 4, 6, 0, 4]
+        for weighted in [False, True]:
+            hop = freud.order.Hexatic(k=ks, weighted=weighted)
+            hop.compute(system=(box, points), neighbors=voro.nlist)
+            assert hop.k == ks
+            assert hop.particle_order.shape == (len(points), len(ks))
+            for i, k in enumerate(ks):
+                single = freud.order.Hexatic(k=k, weighted=weighted)
+                single.compute(system=(box, points), neighbors=voro.nlist)
+                npt.assert_allclose(
+                    hop.particle_order[:, i], single.particle_order, atol=1e-5
+                )
+
+        with pytest.raises(ValueError):
+            freud.order.Hexatic(k=[])
+
     def test_3d_box(self):
         boxlen = 10
         N = 500
@@ -205,6 +225,9 @@ class TestHexatic:
         hop = freud.order.Hexatic(7, weighted=True)
         assert str(hop) == str(eval(repr(hop)))
 
+        hop = freud.order.Hexatic([4, 6, 12])
+        assert str(hop) == str(eval(repr(hop)))
+
     def test_repr_png(self):
         boxlen = 10
         N = 500
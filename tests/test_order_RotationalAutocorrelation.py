@@ -83,6 +83,73 @@ class TestRotationalAutocorrelation:
     def test_repr(self):
         ra2 = freud.order.RotationalAutocorrelation(2)
         assert str(ra2) == str(eval(repr(ra2)))
+        ra = freud.order.RotationalAutocorrelation([2, 6], max_lag=5, origin_interval=2)
+        assert str(ra) == str(eval(repr(ra)))
+
+    def test_multiple_l(self):
+        """Computing several l at once matches computing each l separately."""
+        np.random.seed(0)
+        ref_orientations = rowan.random.rand(50)
+        orientations = rowan.random.rand(50)
+        ls = [6, 2, 12]
+
+        ra = freud.order.RotationalAutocorrelation(ls)
+        ra.compute(ref_orientations, orientations)
+        assert ra.l == ls
+        npt.assert_equal(ra.particle_order.shape, (50, len(ls)))
+        npt.assert_equal(ra.order.shape, (len(ls),))
+        for i, l in enumerate(ls):
+            single = freud.order.RotationalAutocorrelation(l)
+            single.compute(ref_orientations, orientations)
+            npt.assert_allclose(ra.particle_order[:, i], single.particle_order)
+            npt.assert_allclose(ra.order[i], single.order)
+
+        with pytest.raises(ValueError):
+            freud.order.RotationalAutocorrelation([2, 3])
+
+    def test_accumulate(self):
+        """The accumulated time correlation is the average of compute over
+        all pairs of origins and frames."""
+        np.random.seed(0)
+        num_frames, max_lag, origin_interval = 12, 5, 2
+        orientations = [rowan.random.rand(20)]
+        for _ in range(num_frames - 1):
+            axes = np.random.rand(20, 3)
+            axes /= np.linalg.norm(axes, axis=-1)[:, np.newaxis]
+            step = rowan.from_axis_angle(axes, 0.3)
+            orientations.append(rowan.multiply(orientations[-1], step))
+        ls = [2, 4]
+
+        ra = freud.order.RotationalAutocorrelation(
+            ls, max_lag=max_lag, origin_interval=origin_interval
+        )
+        with pytest.raises(AttributeError):
+            ra.correlation
+        for frame in orientations:
+            ra.accumulate(frame)
+        assert ra.num_frames == num_frames
+
+        single = freud.order.RotationalAutocorrelation(ls)
+        for lag in range(max_lag + 1):
+            origins = range(0, num_frames - lag, origin_interval)
+            expected = np.mean(
+                [
+                    single.compute(orientations[t], orientations[t + lag]).order
+                    for t in origins
+                ],
+                axis=0,
+            )
+            assert ra.num_origins[lag] == len(origins)
+            npt.assert_allclose(ra.correlation[lag], expected, rtol=1e-5, atol=1e-6)
+        npt.assert_allclose(ra.correlation[0], 1, rtol=1e-6)
+
+        with pytest.raises(ValueError):
+            ra.accumulate(orientations[0][:10])
+
+        ra.reset()
+        assert ra.num_frames == 0
+        ra.accumulate(orientations[0])
+        npt.assert_equal(ra.num_origins, [1] + [0] * max_lag)
 
 
 def quat_to_greek(q):
@@ -154,7 +221,7 @@ class TestRotationalAutocorrelationReference:
 
     N = 100
     for seed in range(5):
-        for l in [4, 6, 8]:
+        for l in [4, 6, 8, 12]:
             np.random.seed(seed)
             orientations = rowan.random.rand(N)
             ref_orientations = rowan.random.rand(N)
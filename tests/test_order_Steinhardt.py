@@ -57,6 +57,40 @@ class TestSteinhardt:
             comp.compute((box, positions), neighbors={"num_neighbors": 2})
             npt.assert_allclose(comp.particle_order, 1, atol=1e-5)
 
+    @pytest.mark.parametrize("l", [1, 4, 6, 12])
+    def test_random_against_scipy(self, l):
+        """Compare weighted ql of random environments against spherical
+        harmonics computed explicitly with scipy."""
+        special = pytest.importorskip("scipy.special")
+        box, points = freud.data.make_random_system(8, 200, seed=0)
+        aq = freud.locality.AABBQuery(box, points)
+        qargs = dict(num_neighbors=12, exclude_ii=True)
+        nlist = aq.query(points, qargs).toNeighborList()
+        np.random.seed(0)
+        nlist = freud.locality.NeighborList.from_arrays(
+            len(points),
+            len(points),
+            nlist.query_point_indices,
+            nlist.point_indices,
+            nlist.distances,
+            np.random.rand(len(nlist)) + 0.5,
+        )
+
+        comp = freud.order.Steinhardt(l, weighted=True)
+        comp.compute((box, points), neighbors=nlist)
+
+        bonds = points[nlist.point_indices] - points[nlist.query_point_indices]
+        bonds = box.wrap(bonds)
+        theta = np.arccos(bonds[:, 2] / np.linalg.norm(bonds, axis=-1))
+        phi = np.arctan2(bonds[:, 1], bonds[:, 0])
+        ms = np.arange(-l, l + 1)[:, np.newaxis]
+        ylm = special.sph_harm(ms, l, phi, theta) * nlist.weights
+        qlm = np.stack(
+            [np.add.reduceat(ylm_m, nlist.segments) for ylm_m in ylm], axis=-1
+        ) / np.add.reduceat(nlist.weights, nlist.segments)[:, np.newaxis]
+        ql = np.sqrt(4 * np.pi / (2 * l + 1) * np.sum(np.abs(qlm) ** 2, axis=-1))
+        npt.assert_allclose(comp.particle_order, ql, rtol=1e-4, atol=1e-5)
+
     def test_identical_environments_ql(self):
         box, positions = freud.data.UnitCell.fcc().generate_system(4, scale=2)
         r_max = 1.5
@@ -234,6 +268,17 @@ class TestSteinhardt:
         comp.order
         comp.particle_order
 
+    def test_half_list(self):
+        box, positions = freud.data.UnitCell.fcc().generate_system(4)
+        aq = freud.locality.AABBQuery(box, positions)
+        query_args = dict(r_max=1.5, half_list=True)
+        comp = freud.order.Steinhardt(6)
+        with pytest.raises(ValueError):
+            comp.compute(aq, neighbors=query_args)
+        nlist = aq.query(positions, query_args).toNeighborList()
+        with pytest.raises(ValueError):
+            comp.compute(aq, neighbors=nlist)
+
     def test_compute_twice_norm(self):
         """Test that computing norm twice works as expected."""
         L = 5
@@ -246,6 +291,70 @@ class TestSteinhardt:
 
         npt.assert_array_almost_equal(first_result, second_result)
 
+    @pytest.mark.parametrize("l", [21, 24, 31])
+    def test_wl_large_l(self, l):
+        """wl is defined for l beyond any tabulated coefficients. It must be
+        rotationally invariant and vanish identically for odd l."""
+        positions = np.random.default_rng(0).uniform(-1, 1, size=(13, 3))
+        positions[0] = 0
+        box = freud.box.Box.cube(10)
+        nlist = freud.locality.NeighborList.from_arrays(
+            len(positions),
+            len(positions),
+            np.zeros(len(positions) - 1),
+            np.arange(1, len(positions)),
+            np.linalg.norm(positions[1:], axis=-1),
+        )
+
+        comp = freud.order.Steinhardt(l, wl=True)
+        comp.compute((box, positions), neighbors=nlist)
+        wl = comp.particle_order[0]
+        if l % 2 == 1:
+            assert wl == 0
+            return
+        assert wl != 0
+
+        np.random.seed(0)
+        positions_rotated = rowan.rotate(rowan.random.rand(), positions)
+        comp.compute((box, positions_rotated), neighbors=nlist)
+        npt.assert_allclose(comp.particle_order[0], wl, rtol=1e-3)
+
+    @pytest.mark.parametrize("use_nlist", [False, True])
+    def test_average_against_explicit(self, use_nlist):
+        """Compare averaged ql against an explicit average of qlm over the
+        second neighbor shell, with varying numbers of neighbors."""
+        special = pytest.importorskip("scipy.special")
+        l = 6
+        box, points = freud.data.make_random_system(8, 200, seed=0)
+        qargs = dict(r_max=1.6, exclude_ii=True)
+        nlist = freud.locality.AABBQuery(box, points).query(points, qargs)
+        nlist = nlist.toNeighborList()
+
+        comp = freud.order.Steinhardt(l, average=True)
+        comp.compute((box, points), neighbors=nlist if use_nlist else qargs)
+
+        bonds = points[nlist.point_indices] - points[nlist.query_point_indices]
+        bonds = box.wrap(bonds)
+        theta = np.arccos(bonds[:, 2] / np.linalg.norm(bonds, axis=-1))
+        phi = np.arctan2(bonds[:, 1], bonds[:, 0])
+        ms = np.arange(-l, l + 1)[:, np.newaxis]
+        ylm = special.sph_harm(ms, l, phi, theta).T
+        qlm = np.zeros((len(points), 2 * l + 1), dtype=np.complex128)
+        np.add.at(qlm, nlist.query_point_indices, ylm)
+        qlm /= nlist.neighbor_counts[:, np.newaxis]
+
+        qlm_ave = qlm.copy()
+        counts = np.ones(len(points))
+        for i, j in nlist[:]:
+            neighbors_of_j = nlist.point_indices[nlist.query_point_indices == j]
+            qlm_ave[i] += np.sum(qlm[neighbors_of_j], axis=0)
+            counts[i] += len(neighbors_of_j)
+        qlm_ave /= counts[:, np.newaxis]
+        ql_ave = np.sqrt(
+            4 * np.pi / (2 * l + 1) * np.sum(np.abs(qlm_ave) ** 2, axis=-1)
+        )
+        npt.assert_allclose(comp.particle_order, ql_ave, rtol=1e-4, atol=1e-5)
+
     def test_rotational_invariance(self):
         box = freud.box.Box.cube(10)
         positions = np.array(
@@ -298,12 +407,45 @@ class TestSteinhardt:
             npt.assert_allclose(w6.particle_order[0], w6_unrotated_order, rtol=1e-5)
             npt.assert_allclose(w6.particle_order[0], PERFECT_FCC_W6, rtol=1e-5)
 
+    @pytest.mark.parametrize("average", [False, True])
+    @pytest.mark.parametrize("wl", [False, True])
+    def test_multiple_l(self, average, wl):
+        """Computing several l at once matches computing each l separately."""
+        box, points = freud.data.make_random_system(10, 500, seed=0)
+        neighbors = {"num_neighbors": 12, "exclude_ii": True}
+        ls = [4, 6, 8, 6, 0]
+
+        comp = freud.order.Steinhardt(ls, average=average, wl=wl, wl_normalize=wl)
+        comp.compute((box, points), neighbors=neighbors)
+        assert comp.l == ls
+        npt.assert_equal(comp.particle_order.shape, (len(points), len(ls)))
+        npt.assert_equal(comp.ql.shape, (len(points), len(ls)))
+        npt.assert_equal(comp.order.shape, (len(ls),))
+
+        for i, l in enumerate(ls):
+            single = freud.order.Steinhardt(l, average=average, wl=wl, wl_normalize=wl)
+            single.compute((box, points), neighbors=neighbors)
+            assert np.isscalar(single.order)
+            npt.assert_allclose(comp.particle_order[:, i], single.particle_order)
+            npt.assert_allclose(comp.ql[:, i], single.ql)
+            npt.assert_allclose(comp.order[i], single.order)
+
+        # A sequence with a single l still returns 2D arrays
+        comp = freud.order.Steinhardt([6])
+        comp.compute((box, points), neighbors=neighbors)
+        npt.assert_equal(comp.particle_order.shape, (len(points), 1))
+
+        with pytest.raises(ValueError):
+            freud.order.Steinhardt([])
+
     def test_repr(self):
         comp = freud.order.Steinhardt(6)
         assert str(comp) == str(eval(repr(comp)))
         # Use non-default arguments for all parameters
         comp = freud.order.Steinhardt(6, average=True, wl=True, weighted=True)
         assert str(comp) == str(eval(repr(comp)))
+        comp = freud.order.Steinhardt([4, 6], average=True)
+        assert str(comp) == str(eval(repr(comp)))
 
     def test_repr_png(self):
         L = 5
@@ -315,6 +457,9 @@ class TestSteinhardt:
             st.plot()
         assert st._repr_png_() is None
 
+        st.compute(system=(box, points), neighbors={"r_max": 1.5})
+        st._repr_png_()
+        st = freud.order.Steinhardt([4, 6])
         st.compute(system=(box, points), neighbors={"r_max": 1.5})
         st._repr_png_()
         plt.close("all")
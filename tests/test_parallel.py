@@ -1,3 +1,8 @@
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import numpy.testing as npt
+
 import freud
 
 
@@ -30,3 +35,66 @@ class TestParallel:
         # After the context manager, the number of threads should revert
         # to its previous value.
         assert freud.parallel.get_num_threads() == 1
+
+
+def _analyze_frame(box, points):
+    """Run several independent computes on one frame."""
+    rdf = freud.density.RDF(bins=50, r_max=3)
+    rdf.compute((box, points), reset=False)
+
+    cl = freud.cluster.Cluster()
+    cl.compute((box, points), neighbors={"r_max": 1.0})
+
+    ql = freud.order.Steinhardt(6)
+    ql.compute((box, points), neighbors={"num_neighbors": 12})
+
+    aq = freud.locality.AABBQuery(box, points)
+    nlist = aq.query(points, {"r_max": 1.5, "exclude_ii": True}).toNeighborList()
+
+    return (
+        rdf.rdf,
+        cl.num_clusters,
+        np.sort(np.bincount(cl.cluster_idx)),
+        ql.particle_order,
+        nlist[:],
+        box.wrap(points * 2),
+    )
+
+
+class TestConcurrentCompute:
+    """Ensure that separate compute objects can be used from Python threads,
+    which run concurrently because the GIL is released in C++ calls."""
+
+    def test_threaded_stress(self):
+        num_frames = 24
+        frames = [
+            freud.data.make_random_system(10, 1000, seed=i) for i in range(num_frames)
+        ]
+        serial = [_analyze_frame(box, points) for box, points in frames]
+
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            threaded = list(executor.map(lambda f: _analyze_frame(*f), frames * 2))
+
+        for i, result in enumerate(threaded):
+            expected = serial[i % num_frames]
+            npt.assert_allclose(result[0], expected[0], rtol=1e-6)
+            assert result[1] == expected[1]
+            npt.assert_array_equal(result[2], expected[2])
+            npt.assert_allclose(result[3], expected[3], rtol=1e-5, atol=1e-6)
+            npt.assert_array_equal(result[4], expected[4])
+            npt.assert_allclose(result[5], expected[5])
+
+    def test_shared_neighbor_query(self):
+        """Concurrent queries may share a single NeighborQuery."""
+        box, points = freud.data.make_random_system(10, 2000, seed=0)
+        aq = freud.locality.AABBQuery(box, points)
+        query_args = [{"num_neighbors": k, "exclude_ii": True} for k in range(1, 9)]
+
+        def query(qargs):
+            return aq.query(points, qargs).toNeighborList()[:]
+
+        serial = [query(qargs) for qargs in query_args]
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            threaded = list(executor.map(query, query_args * 4))
+        for i, result in enumerate(threaded):
+            npt.assert_array_equal(result, serial[i % len(query_args)])